@@ -5,6 +5,7 @@
 
 #include "collision_detection.h"
 
-bool check_aabb_collision(float x1, float y1, float w1, float h1, float x2, float y2, float w2, float h2) {
+bool check_aabb_collision(sim_scalar_t x1, sim_scalar_t y1, sim_scalar_t w1, sim_scalar_t h1, sim_scalar_t x2,
+                          sim_scalar_t y2, sim_scalar_t w2, sim_scalar_t h2) {
     return (x1 < x2 + w2 && x1 + w1 > x2 && y1 < y2 + h2 && y1 + h1 > y2);
 }
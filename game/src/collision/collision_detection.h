@@ -4,11 +4,14 @@
  *
  * Provides basic AABB collision detection for all game entities.
  * No patterns, no abstractions - just simple geometry checks.
+ * Coordinates are simulation scalars, so the deterministic profile
+ * compares integers.
  */
 
 #ifndef COLLISION_DETECTION_H
 #define COLLISION_DETECTION_H
 
+#include "sim_scalar.h"
 #include <stdbool.h>
 
 /**
@@ -23,6 +26,7 @@
  * @param h2 Second rectangle height
  * @return true if rectangles overlap
  */
-bool check_aabb_collision(float x1, float y1, float w1, float h1, float x2, float y2, float w2, float h2);
+bool check_aabb_collision(sim_scalar_t x1, sim_scalar_t y1, sim_scalar_t w1, sim_scalar_t h1, sim_scalar_t x2,
+                          sim_scalar_t y2, sim_scalar_t w2, sim_scalar_t h2);
 
 #endif // COLLISION_DETECTION_H
@@ -6,7 +6,6 @@
 #include "collision_handlers.h"
 #include "audio.h"
 #include "brick.h"
-#include "clock.h"
 #include "collision_detection.h"
 #include "constants.h"
 #include "crab.h"
@@ -16,13 +15,28 @@
 #include "jellyfish.h"
 #include "popcorn.h"
 
+// Sprite sizes in simulation units
+#define POPCORN_SIM_WIDTH SIM_FROM_INT(POPCORN_WIDTH)
+#define POPCORN_SIM_HEIGHT SIM_FROM_INT(POPCORN_HEIGHT)
+#define CRAB_SIM_WIDTH SIM_FROM_INT(CRAB_WIDTH)
+#define CRAB_SIM_HEIGHT SIM_FROM_INT(CRAB_HEIGHT)
+#define JELLYFISH_SIM_WIDTH SIM_FROM_INT(JELLYFISH_WIDTH)
+#define JELLYFISH_SIM_HEIGHT SIM_FROM_INT(JELLYFISH_HEIGHT)
+#define DUCK_SIM_WIDTH SIM_FROM_INT(DUCK_WIDTH)
+#define DUCK_SIM_HEIGHT SIM_FROM_INT(DUCK_HEIGHT)
+#define BRICK_SIM_WIDTH SIM_FROM_INT(BRICK_WIDTH)
+#define BRICK_SIM_HEIGHT SIM_FROM_INT(BRICK_HEIGHT)
+
 bool handle_popcorn_crab_collision(game_ptr game, popcorn_ptr popcorn, crab_ptr crab) {
     if (!popcorn || !crab || !popcorn->active || popcorn->reflected || !crab->alive) {
         return false;
     }
 
-    if (check_aabb_collision(popcorn->x, popcorn->y, POPCORN_WIDTH, POPCORN_HEIGHT, crab->x, crab->y, CRAB_WIDTH,
-                             CRAB_HEIGHT)) {
+    // Analytic movers are evaluated at the current simulation tick
+    sim_scalar_t popcorn_top = popcorn_y(popcorn, game->sim_tick);
+    sim_scalar_t crab_left = crab_x(crab, game->sim_tick);
+    if (check_aabb_collision(popcorn->x, popcorn_top, POPCORN_SIM_WIDTH, POPCORN_SIM_HEIGHT, crab_left, crab->y,
+                             CRAB_SIM_WIDTH, CRAB_SIM_HEIGHT)) {
         // Kill crab
         crab->alive = false;
 
@@ -33,7 +47,7 @@ bool handle_popcorn_crab_collision(game_ptr game, popcorn_ptr popcorn, crab_ptr
         play_sound(&game->audio_context, SOUND_CRAB_HIT);
 
         // Publish collision event
-        crab_destroyed_data_t event_data = {crab->x, crab->y};
+        crab_destroyed_data_t event_data = {SIM_TO_FLOAT(crab_left), SIM_TO_FLOAT(crab->y)};
         game_event_t event = {.type = GAME_EVENT_CRAB_DESTROYED, .data = &event_data, .data_size = sizeof(event_data)};
         publish(&game->event_system, &event);
 
@@ -43,19 +57,26 @@ bool handle_popcorn_crab_collision(game_ptr game, popcorn_ptr popcorn, crab_ptr
     return false;
 }
 
-bool handle_popcorn_jellyfish_collision(game_ptr game, popcorn_ptr popcorn, jellyfish_ptr jellyfish) {
-    (void)game; // Not used in this collision
+bool handle_popcorn_jellyfish_collision(game_ptr game, popcorn_ptr popcorn, jellyfish_formation_ptr formation) {
+    if (!popcorn || !formation || !popcorn->active || popcorn->reflected) {
+        return false;
+    }
 
-    if (!popcorn || !jellyfish || !popcorn->active || popcorn->reflected) {
+    // Broad phase: most popcorn never comes near the formation
+    sim_scalar_t popcorn_top = popcorn_y(popcorn, game->sim_tick);
+    if (!check_aabb_collision(popcorn->x, popcorn_top, POPCORN_SIM_WIDTH, POPCORN_SIM_HEIGHT, formation->x,
+                              formation->y, formation->width, formation->height)) {
         return false;
     }
 
-    if (check_aabb_collision(popcorn->x, popcorn->y, POPCORN_WIDTH, POPCORN_HEIGHT, jellyfish->x, jellyfish->y,
-                             JELLYFISH_WIDTH, JELLYFISH_HEIGHT)) {
-        // Reflect popcorn downward
-        popcorn_reflect(popcorn);
+    for (int i = 0; i < formation->member_count; i++) {
+        if (check_aabb_collision(popcorn->x, popcorn_top, POPCORN_SIM_WIDTH, POPCORN_SIM_HEIGHT, formation->member_x[i],
+                                 formation->member_y[i], JELLYFISH_SIM_WIDTH, JELLYFISH_SIM_HEIGHT)) {
+            // Reflect popcorn downward
+            popcorn_reflect(popcorn, &game->motion_events, game->sim_tick, LOGICAL_HEIGHT);
 
-        return true;
+            return true;
+        }
     }
 
     return false;
@@ -66,11 +87,10 @@ bool handle_popcorn_duck_collision(game_ptr game, popcorn_ptr popcorn, duck_ptr
         return false;
     }
 
-    if (check_aabb_collision(popcorn->x, popcorn->y, POPCORN_WIDTH, POPCORN_HEIGHT, duck->x, duck->y, DUCK_WIDTH,
-                             DUCK_HEIGHT)) {
-        // Kill duck
-        duck->dead = true;
-        duck->death_time = get_clock_ticks_ms();
+    if (check_aabb_collision(popcorn->x, popcorn_y(popcorn, game->sim_tick), POPCORN_SIM_WIDTH, POPCORN_SIM_HEIGHT,
+                             duck->x, duck->y, DUCK_SIM_WIDTH, DUCK_SIM_HEIGHT)) {
+        // Kill duck (respawn is scheduled on the timer wheel)
+        duck_kill(duck, &game->timers, &game->animations, game->sim_time);
 
         // Deactivate popcorn
         popcorn->active = false;
@@ -79,7 +99,7 @@ bool handle_popcorn_duck_collision(game_ptr game, popcorn_ptr popcorn, duck_ptr
         play_sound(&game->audio_context, SOUND_DUCK_DEATH);
 
         // Publish death event
-        duck_died_data_t event_data = {duck->x, duck->y};
+        duck_died_data_t event_data = {SIM_TO_FLOAT(duck->x), SIM_TO_FLOAT(duck->y)};
         game_event_t event = {.type = GAME_EVENT_DUCK_DIED, .data = &event_data, .data_size = sizeof(event_data)};
         publish(&game->event_system, &event);
 
@@ -94,17 +114,16 @@ bool handle_brick_duck_collision(game_ptr game, brick_ptr brick, duck_ptr duck)
         return false;
     }
 
-    if (check_aabb_collision(duck->x, duck->y, DUCK_WIDTH, DUCK_HEIGHT, brick->x, brick->y, BRICK_WIDTH,
-                             BRICK_HEIGHT)) {
-        // Kill duck
-        duck->dead = true;
-        duck->death_time = get_clock_ticks_ms();
+    if (check_aabb_collision(duck->x, duck->y, DUCK_SIM_WIDTH, DUCK_SIM_HEIGHT, brick->x,
+                             brick_y(brick, game->sim_tick), BRICK_SIM_WIDTH, BRICK_SIM_HEIGHT)) {
+        // Kill duck (respawn is scheduled on the timer wheel)
+        duck_kill(duck, &game->timers, &game->animations, game->sim_time);
 
         // Play death sound
         play_sound(&game->audio_context, SOUND_DUCK_DEATH);
 
         // Publish death event
-        duck_died_data_t event_data = {duck->x, duck->y};
+        duck_died_data_t event_data = {SIM_TO_FLOAT(duck->x), SIM_TO_FLOAT(duck->y)};
         game_event_t event = {.type = GAME_EVENT_DUCK_DIED, .data = &event_data, .data_size = sizeof(event_data)};
         publish(&game->event_system, &event);
 
@@ -114,20 +133,19 @@ bool handle_brick_duck_collision(game_ptr game, brick_ptr brick, duck_ptr duck)
     return false;
 }
 
-bool check_duck_brick_landing_collision(game_ptr game, float duck_x) {
+bool check_duck_brick_landing_collision(game_ptr game, sim_scalar_t duck_x) {
     if (!game) {
         return false;
     }
 
     // Check collision with all landed bricks
-    for (size_t i = 0; i < game->brick_pool.capacity; i++) {
-        if (pool_is_active(&game->brick_pool, i)) {
-            brick_ptr brick = (brick_ptr)pool_get_at(&game->brick_pool, i);
-            if (brick && brick->landed) {
-                if (check_aabb_collision(duck_x, game->duck.y, DUCK_WIDTH, DUCK_HEIGHT, brick->x, brick->y, BRICK_WIDTH,
-                                         BRICK_HEIGHT)) {
-                    return true;
-                }
+    ring_pool_iter_t iter = ring_pool_iter(&game->brick_pool);
+    while (ring_pool_iter_next(&iter)) {
+        brick_ptr brick = (brick_ptr)iter.element;
+        if (brick->landed) {
+            if (check_aabb_collision(duck_x, game->duck.y, DUCK_SIM_WIDTH, DUCK_SIM_HEIGHT, brick->x,
+                                     brick_y(brick, game->sim_tick), BRICK_SIM_WIDTH, BRICK_SIM_HEIGHT)) {
+                return true;
             }
         }
     }
@@ -23,12 +23,15 @@ bool handle_popcorn_crab_collision(game_ptr game, popcorn_ptr popcorn, crab_ptr
 
 /**
  * @brief Handle popcorn hitting a jellyfish (reflects popcorn)
+ *
+ * Tests the formation bounding box first and only then the individual members.
+ *
  * @param game Game state
  * @param popcorn Popcorn
- * @param jellyfish Target jellyfish
+ * @param formation Target jellyfish formation
  * @return true if collision occurred
  */
-bool handle_popcorn_jellyfish_collision(game_ptr game, popcorn_ptr popcorn, jellyfish_ptr jellyfish);
+bool handle_popcorn_jellyfish_collision(game_ptr game, popcorn_ptr popcorn, jellyfish_formation_ptr formation);
 
 /**
  * @brief Handle reflected popcorn hitting the duck
@@ -54,6 +57,6 @@ bool handle_brick_duck_collision(game_ptr game, brick_ptr brick, duck_ptr duck);
  * @param duck_x Duck's x position to check
  * @return true if duck would collide with landed bricks
  */
-bool check_duck_brick_landing_collision(game_ptr game, float duck_x);
+bool check_duck_brick_landing_collision(game_ptr game, sim_scalar_t duck_x);
 
 #endif // COLLISION_HANDLERS_H
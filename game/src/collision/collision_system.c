@@ -6,79 +6,118 @@
 #include "collision_system.h"
 #include "brick.h"
 #include "collision_handlers.h"
+#include "constants.h"
 #include "crab.h"
+#include "crab_broadphase.h"
 #include "duck.h"
 #include "jellyfish.h"
 #include "popcorn.h"
 
 static bool system_initialized = false;
 
+// Crab positions filed by cell, rebuilt at the start of every update
+static crab_broadphase_t crab_grid;
+
 bool collision_system_init(game_ptr game) {
     if (!game) {
         return false;
     }
 
+    if (!crab_broadphase_init(&crab_grid, game->crab_pool.max_capacity, LOGICAL_WIDTH, CRAB_ZONE_HEIGHT)) {
+        return false;
+    }
+
     system_initialized = true;
     return true;
 }
 
-void collision_system_update(game_ptr game) {
-    if (!game || !system_initialized) {
-        return;
+static void collide_popcorn(game_ptr game, popcorn_ptr popcorn, sim_scalar_t popcorn_top) {
+    // Broad phase: crabs only walk in the top band of the screen and ignore reflected popcorn,
+    // and the grid only hands back crabs near the popcorn
+    if (!popcorn->reflected && popcorn_top < SIM_FROM_INT(CRAB_ZONE_HEIGHT)) {
+        crab_ptr crab = crab_broadphase_query(&crab_grid, popcorn->x, popcorn_top, SIM_FROM_INT(POPCORN_WIDTH),
+                                              SIM_FROM_INT(POPCORN_HEIGHT));
+        if (crab) {
+            handle_popcorn_crab_collision(game, popcorn, crab);
+        }
     }
 
-    // Process popcorn collisions with crabs
-    for (size_t i = 0; i < game->popcorn_pool.capacity; i++) {
-        if (!pool_is_active(&game->popcorn_pool, i))
-            continue;
+    // If popcorn is still active and not reflected, check the jellyfish formation
+    if (popcorn->active && !popcorn->reflected) {
+        handle_popcorn_jellyfish_collision(game, popcorn, &game->jellyfish_formation);
+    }
 
-        popcorn_ptr popcorn = (popcorn_ptr)pool_get_at(&game->popcorn_pool, i);
-        if (!popcorn || !popcorn->active)
+    // If popcorn is reflected, check collision with duck
+    if (popcorn->active && popcorn->reflected) {
+        handle_popcorn_duck_collision(game, popcorn, &game->duck);
+    }
+}
+
+static void update_popcorn_separate(game_ptr game) {
+    ring_pool_iter_t popcorn_iter = ring_pool_iter(&game->popcorn_pool);
+    while (ring_pool_iter_next(&popcorn_iter)) {
+        popcorn_ptr popcorn = (popcorn_ptr)popcorn_iter.element;
+        if (!popcorn->active)
             continue;
 
-        // Check collision with all crabs
-        for (size_t j = 0; j < game->crab_pool.capacity; j++) {
-            if (!pool_is_active(&game->crab_pool, j))
-                continue;
+        collide_popcorn(game, popcorn, popcorn_y(popcorn, game->sim_tick));
+    }
+}
 
-            crab_ptr crab = (crab_ptr)pool_get_at(&game->crab_pool, j);
-            if (handle_popcorn_crab_collision(game, popcorn, crab)) {
-                break; // Popcorn destroyed, no more collisions
+static void update_popcorn_fused(game_ptr game) {
+    // One visit per popcorn does the work of popcorn_update_all, the collision pass and the
+    // render walk while the popcorn is still in cache
+    popcorn_draw_list_ptr draws = &game->popcorn_draws;
+    draws->count = 0;
+
+    ring_pool_iter_t popcorn_iter = ring_pool_iter(&game->popcorn_pool);
+    while (ring_pool_iter_next(&popcorn_iter)) {
+        popcorn_ptr popcorn = (popcorn_ptr)popcorn_iter.element;
+        if (!popcorn->active) {
+            // Spent popcorn ahead of every live one in its segment goes back to the ring; the slot
+            // will be reused, so a pending event must not match it
+            if (ring_pool_iter_at_head(&popcorn_iter)) {
+                popcorn->exit_event = MOTION_EVENT_NONE;
+                ring_pool_iter_release(&popcorn_iter);
             }
+            continue;
         }
 
-        // If popcorn is still active and not reflected, check jellyfish
-        if (popcorn->active && !popcorn->reflected) {
-            for (size_t j = 0; j < game->jellyfish_pool.capacity; j++) {
-                if (!pool_is_active(&game->jellyfish_pool, j))
-                    continue;
+        sim_scalar_t popcorn_top = popcorn_y(popcorn, game->sim_tick);
+        collide_popcorn(game, popcorn, popcorn_top);
 
-                jellyfish_ptr jellyfish = (jellyfish_ptr)pool_get_at(&game->jellyfish_pool, j);
-                if (handle_popcorn_jellyfish_collision(game, popcorn, jellyfish)) {
-                    break; // Popcorn reflected, check next popcorn
-                }
-            }
+        // Reflection keeps the position at this tick, so the same height is drawn
+        if (popcorn->active) {
+            popcorn_draw_list_push(draws, popcorn, popcorn_top);
         }
+    }
+}
 
-        // If popcorn is reflected, check collision with duck
-        if (popcorn->active && popcorn->reflected) {
-            handle_popcorn_duck_collision(game, popcorn, &game->duck);
-        }
+void collision_system_update(game_ptr game) {
+    if (!game || !system_initialized) {
+        return;
     }
 
-    // Process brick collisions with duck
-    for (size_t i = 0; i < game->brick_pool.capacity; i++) {
-        if (!pool_is_active(&game->brick_pool, i))
-            continue;
+    crab_broadphase_rebuild(&crab_grid, &game->crab_pool, game->sim_tick);
 
-        brick_ptr brick = (brick_ptr)pool_get_at(&game->brick_pool, i);
+    // Process popcorn collisions with crabs, the jellyfish formation and the duck
+    if (game->fused_popcorn_pass) {
+        update_popcorn_fused(game);
+    } else {
+        update_popcorn_separate(game);
+    }
+
+    // Process brick collisions with duck
+    ring_pool_iter_t brick_iter = ring_pool_iter(&game->brick_pool);
+    while (ring_pool_iter_next(&brick_iter)) {
+        brick_ptr brick = (brick_ptr)brick_iter.element;
         if (handle_brick_duck_collision(game, brick, &game->duck)) {
             break; // Duck died, no need to check more bricks
         }
     }
 }
 
-bool collision_system_check_duck_landing(game_ptr game, float duck_x) {
+bool collision_system_check_duck_landing(game_ptr game, sim_scalar_t duck_x) {
     if (!system_initialized) {
         return false;
     }
@@ -86,4 +125,7 @@ bool collision_system_check_duck_landing(game_ptr game, float duck_x) {
     return check_duck_brick_landing_collision(game, duck_x);
 }
 
-void collision_system_cleanup(void) { system_initialized = false; }
+void collision_system_cleanup(void) {
+    crab_broadphase_destroy(&crab_grid);
+    system_initialized = false;
+}
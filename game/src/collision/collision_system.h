@@ -21,6 +21,10 @@ bool collision_system_init(game_ptr game);
 
 /**
  * @brief Process all collisions for the current frame
+ *
+ * With game->fused_popcorn_pass set, spent popcorn is also released and the
+ * popcorn draw list is filled in the same pass over the popcorn ring.
+ *
  * @param game Game state
  */
 void collision_system_update(game_ptr game);
@@ -31,7 +35,7 @@ void collision_system_update(game_ptr game);
  * @param duck_x Duck's x position to check
  * @return true if duck would collide with landed bricks
  */
-bool collision_system_check_duck_landing(game_ptr game, float duck_x);
+bool collision_system_check_duck_landing(game_ptr game, sim_scalar_t duck_x);
 
 /**
  * @brief Cleanup the collision system
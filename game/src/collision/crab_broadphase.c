@@ -0,0 +1,121 @@
+/**
+ * @file crab_broadphase.c
+ * @brief Uniform grid of crab positions implementation
+ */
+
+#include "crab_broadphase.h"
+#include "collision_detection.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Cell coordinate along one axis, clamped to the grid; monotonic, so a crab
+// overlapping a box is always filed inside the cell range the box queries
+static int cell_coordinate(sim_scalar_t position, int cell_size, int cells) {
+    int cell = SIM_TO_INT(position) / cell_size;
+    if (cell < 0) {
+        return 0;
+    }
+    return cell < cells ? cell : cells - 1;
+}
+
+bool crab_broadphase_init(crab_broadphase_ptr grid, size_t capacity, int width, int height) {
+    memset(grid, 0, sizeof(*grid));
+
+    if (capacity == 0 || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    grid->columns = (width + CRAB_BROADPHASE_CELL_WIDTH - 1) / CRAB_BROADPHASE_CELL_WIDTH;
+    grid->rows = (height + CRAB_BROADPHASE_CELL_HEIGHT - 1) / CRAB_BROADPHASE_CELL_HEIGHT;
+
+    size_t cell_count = (size_t)grid->columns * (size_t)grid->rows;
+    grid->entries = malloc(capacity * sizeof(crab_broadphase_entry_t));
+    grid->cell_start = calloc(cell_count + 1, sizeof(uint32_t));
+    grid->unsorted = malloc(capacity * sizeof(crab_broadphase_entry_t));
+    grid->entry_cells = malloc(capacity * sizeof(uint32_t));
+    grid->cell_fill = malloc(cell_count * sizeof(uint32_t));
+    if (!grid->entries || !grid->cell_start || !grid->unsorted || !grid->entry_cells || !grid->cell_fill) {
+        crab_broadphase_destroy(grid);
+        return false;
+    }
+
+    grid->capacity = capacity;
+    return true;
+}
+
+void crab_broadphase_rebuild(crab_broadphase_ptr grid, entity_pool_t *crab_pool, sim_tick_t tick) {
+    size_t cell_count = (size_t)grid->columns * (size_t)grid->rows;
+    uint32_t *cell_start = grid->cell_start;
+    memset(cell_start, 0, (cell_count + 1) * sizeof(uint32_t));
+
+    // Count crabs per cell; live list order is kept within a cell
+    size_t count = 0;
+    entity_pool_iter_t iter = entity_pool_iter(crab_pool);
+    while (entity_pool_iter_next(&iter) && count < grid->capacity) {
+        crab_ptr crab = (crab_ptr)iter.element;
+        if (!crab->alive) {
+            continue;
+        }
+
+        sim_scalar_t x = crab_x(crab, tick);
+        int column = cell_coordinate(x, CRAB_BROADPHASE_CELL_WIDTH, grid->columns);
+        int row = cell_coordinate(crab->y, CRAB_BROADPHASE_CELL_HEIGHT, grid->rows);
+        uint32_t cell = (uint32_t)(row * grid->columns + column);
+
+        grid->unsorted[count].x = x;
+        grid->unsorted[count].y = crab->y;
+        grid->unsorted[count].crab = crab;
+        grid->entry_cells[count] = cell;
+        cell_start[cell + 1]++;
+        count++;
+    }
+
+    // Prefix sum turns the counts into the first entry of each cell
+    for (size_t cell = 0; cell < cell_count; cell++) {
+        cell_start[cell + 1] += cell_start[cell];
+        grid->cell_fill[cell] = cell_start[cell];
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        grid->entries[grid->cell_fill[grid->entry_cells[i]]++] = grid->unsorted[i];
+    }
+
+    grid->count = count;
+}
+
+crab_ptr crab_broadphase_query(const crab_broadphase_t *grid, sim_scalar_t x, sim_scalar_t y, sim_scalar_t width,
+                               sim_scalar_t height) {
+    const sim_scalar_t crab_width = SIM_FROM_INT(CRAB_WIDTH);
+    const sim_scalar_t crab_height = SIM_FROM_INT(CRAB_HEIGHT);
+
+    // A crab overlapping the box has its top-left corner inside the box grown up and left by one crab
+    int first_column = cell_coordinate(x - crab_width, CRAB_BROADPHASE_CELL_WIDTH, grid->columns);
+    int last_column = cell_coordinate(x + width, CRAB_BROADPHASE_CELL_WIDTH, grid->columns);
+    int first_row = cell_coordinate(y - crab_height, CRAB_BROADPHASE_CELL_HEIGHT, grid->rows);
+    int last_row = cell_coordinate(y + height, CRAB_BROADPHASE_CELL_HEIGHT, grid->rows);
+
+    for (int row = first_row; row <= last_row; row++) {
+        for (int column = first_column; column <= last_column; column++) {
+            size_t cell = (size_t)(row * grid->columns + column);
+            for (uint32_t i = grid->cell_start[cell]; i < grid->cell_start[cell + 1]; i++) {
+                const crab_broadphase_entry_t *entry = &grid->entries[i];
+                if (entry->crab->alive &&
+                    check_aabb_collision(x, y, width, height, entry->x, entry->y, crab_width, crab_height)) {
+                    return entry->crab;
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+void crab_broadphase_destroy(crab_broadphase_ptr grid) {
+    free(grid->entries);
+    free(grid->cell_start);
+    free(grid->unsorted);
+    free(grid->entry_cells);
+    free(grid->cell_fill);
+    memset(grid, 0, sizeof(*grid));
+}
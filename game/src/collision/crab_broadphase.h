@@ -0,0 +1,91 @@
+/**
+ * @file crab_broadphase.h
+ * @brief Uniform grid of crab positions for popcorn collision queries
+ *
+ * Rebuilt once per frame with a counting sort: every live crab is filed
+ * under the cell holding its top-left corner, together with its position
+ * at the current tick. A query for a small box visits only the cells a
+ * crab overlapping the box could be filed under (the box grown up and left
+ * by one crab), so each popcorn tests a handful of nearby crabs instead of
+ * the whole population.
+ */
+
+#ifndef GAME_SRC_COLLISION_CRAB_BROADPHASE_H_
+#define GAME_SRC_COLLISION_CRAB_BROADPHASE_H_
+
+#include "crab.h"
+#include "entity_pool.h"
+#include "kinematics.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Cell size in pixels (a crab and a popcorn together span at most two cells each way)
+#define CRAB_BROADPHASE_CELL_WIDTH 64
+#define CRAB_BROADPHASE_CELL_HEIGHT 32
+
+/**
+ * Crab filed in the grid, with its position at the tick the grid was built
+ */
+typedef struct {
+    sim_scalar_t x;
+    sim_scalar_t y;
+    crab_ptr crab;
+} crab_broadphase_entry_t;
+
+/**
+ * Crab grid (cells in row-major order, entries grouped by cell)
+ */
+typedef struct {
+    crab_broadphase_entry_t *entries;  // Crabs sorted by cell
+    uint32_t *cell_start;              // First entry of each cell (cell_count + 1 offsets)
+    crab_broadphase_entry_t *unsorted; // Scratch: crabs in live list order during a rebuild
+    uint32_t *entry_cells;             // Scratch: cell of each unsorted crab
+    uint32_t *cell_fill;               // Scratch: next free entry of each cell
+    size_t capacity;                   // Maximum number of crabs
+    size_t count;                      // Crabs filed by the last rebuild
+    int columns;                       // Cells across
+    int rows;                          // Cells down
+} crab_broadphase_t;
+
+// Pointer typedef for crab broadphase
+typedef crab_broadphase_t *crab_broadphase_ptr;
+
+/**
+ * @brief Allocate a crab grid
+ * @param grid Grid to initialize
+ * @param capacity Maximum number of crabs (the crab pool's maximum capacity)
+ * @param width Width of the covered area (crabs beyond it share the edge cells)
+ * @param height Height of the covered area (crabs beyond it share the edge cells)
+ * @return true if successful
+ */
+bool crab_broadphase_init(crab_broadphase_ptr grid, size_t capacity, int width, int height);
+
+/**
+ * @brief File every live crab under its cell at a simulation tick
+ * @param grid Crab grid
+ * @param crab_pool Object pool for crabs
+ * @param tick Simulation tick crab positions are evaluated at
+ */
+void crab_broadphase_rebuild(crab_broadphase_ptr grid, entity_pool_t *crab_pool, sim_tick_t tick);
+
+/**
+ * @brief Find the first live crab overlapping a box
+ * @param grid Crab grid
+ * @param x Left edge of the box
+ * @param y Top edge of the box
+ * @param width Box width
+ * @param height Box height
+ * @return Overlapping crab, NULL if there is none
+ */
+crab_ptr crab_broadphase_query(const crab_broadphase_t *grid, sim_scalar_t x, sim_scalar_t y, sim_scalar_t width,
+                               sim_scalar_t height);
+
+/**
+ * @brief Free the memory owned by a crab grid
+ * @param grid Crab grid
+ */
+void crab_broadphase_destroy(crab_broadphase_ptr grid);
+
+#endif // GAME_SRC_COLLISION_CRAB_BROADPHASE_H_
@@ -11,9 +11,25 @@
 #include "game.h"
 #include "keyboard.h"
 #include "popcorn.h"
+#include "replay.h"
 #include <stdio.h>
 
-bool player_process_input(game_ptr game) {
+// Keys held this tick, as replay input flags
+static uint8_t read_keyboard(keyboard_state_t *keyboard_state) {
+    uint8_t input = 0;
+    if (is_left_key_pressed(keyboard_state)) {
+        input |= PLAYER_INPUT_LEFT;
+    }
+    if (is_right_key_pressed(keyboard_state)) {
+        input |= PLAYER_INPUT_RIGHT;
+    }
+    if (is_space_key_pressed(keyboard_state)) {
+        input |= PLAYER_INPUT_FIRE;
+    }
+    return input;
+}
+
+bool player_poll_input(game_ptr game, uint8_t *input) {
     // Check for quit event using engine event system
     event_t engine_event = poll_event();
     if (engine_event == QUIT_EVENT) {
@@ -27,17 +43,44 @@ bool player_process_input(game_ptr game) {
         return false;
     }
 
+    *input = read_keyboard(keyboard_state);
+    return true;
+}
+
+bool player_step_input(game_ptr game, uint8_t input) {
+    // Clock and keys for this tick: recorded ones on playback (ending the game with the recording), live otherwise
+    if (game->replay.mode == REPLAY_PLAYBACK) {
+        if (!replay_read_tick(&game->replay, &game->sim_time, &input)) {
+            return false;
+        }
+    } else {
+        game->sim_time = get_clock_ticks_ms();
+        if (game->replay.mode == REPLAY_RECORD) {
+            replay_record_tick(&game->replay, game->sim_time, input);
+        }
+    }
+
+    player_apply_input(game, input);
+    return true;
+}
+
+bool player_process_input(game_ptr game) {
+    uint8_t input;
+    return player_poll_input(game, &input) && player_step_input(game, input);
+}
+
+void player_apply_input(game_ptr game, uint8_t input) {
     // Handle duck movement and shooting controls (only if duck is alive)
     if (!game->duck.dead) {
         // Handle horizontal movement with continuous key checking
-        bool left_pressed = is_left_key_pressed(keyboard_state);
-        bool right_pressed = is_right_key_pressed(keyboard_state);
+        bool left_pressed = (input & PLAYER_INPUT_LEFT) != 0;
+        bool right_pressed = (input & PLAYER_INPUT_RIGHT) != 0;
 
         if (left_pressed && !right_pressed) {
-            game->duck.vx = -DUCK_SPEED;
+            game->duck.vx = -SIM_FROM_FLOAT(DUCK_SPEED);
             game->duck.facing_right = false;
         } else if (right_pressed && !left_pressed) {
-            game->duck.vx = DUCK_SPEED;
+            game->duck.vx = SIM_FROM_FLOAT(DUCK_SPEED);
             game->duck.facing_right = true;
         } else {
             // Stop when no keys or both keys are pressed
@@ -45,21 +88,20 @@ bool player_process_input(game_ptr game) {
         }
 
         // Handle shooting
-        if (is_space_key_pressed(keyboard_state)) {
+        if (input & PLAYER_INPUT_FIRE) {
             // Trigger shooting
-            game->duck.shooting = true;
-            game->duck.shoot_start_time = get_clock_ticks_ms();
+            duck_shoot(&game->duck, &game->timers, &game->animations, game->sim_time);
 
             // Play quack sound
             play_sound(&game->audio_context, SOUND_QUACK);
 
             // Spawn popcorn
             const int duck_sprite_width = DUCK_WIDTH;
-            float offset = game->duck.facing_right ? duck_sprite_width * 0.7f : duck_sprite_width * 0.3f;
+            sim_scalar_t offset = game->duck.facing_right ? SIM_FROM_FLOAT(duck_sprite_width * 0.7f)
+                                                          : SIM_FROM_FLOAT(duck_sprite_width * 0.3f);
 
-            popcorn_spawn(&game->popcorn_pool, game->duck.x + offset, game->duck.y);
+            popcorn_spawn(&game->popcorn_pool, &game->motion_events, game->sim_tick, game->duck.x + offset,
+                          game->duck.y);
         }
     }
-
-    return true;
 }
@@ -8,12 +8,40 @@
 
 #include "game.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
- * @brief Process player input using engine input system
+ * @brief Read quit requests and the held keys (main thread, which owns the event queue)
  * @param game Game state
+ * @param input Receives the held keys as PLAYER_INPUT_* flags
  * @return true if game should continue, false if quit requested
  */
+bool player_poll_input(game_ptr game, uint8_t *input);
+
+/**
+ * @brief Start a tick: sample its clock into game->sim_time and apply its input
+ *
+ * While a replay plays back, the clock and keys come from the recording
+ * instead of the live ones; while one records, both are appended to it.
+ *
+ * @param game Game state
+ * @param input Live keys (PLAYER_INPUT_* flags), ignored on playback
+ * @return false if the replay being played back has ended
+ */
+bool player_step_input(game_ptr game, uint8_t input);
+
+/**
+ * @brief Process player input using engine input system (poll and step on one thread)
+ * @param game Game state
+ * @return true if game should continue, false if quit requested or the replay ended
+ */
 bool player_process_input(game_ptr game);
 
+/**
+ * @brief Move and fire the duck from one tick's input
+ * @param game Game state
+ * @param input PLAYER_INPUT_* flags
+ */
+void player_apply_input(game_ptr game, uint8_t input);
+
 #endif // PLAYER_CONTROLLER_H
@@ -0,0 +1,123 @@
+/**
+ * @file replay.c
+ * @brief Session recording and playback implementation
+ */
+
+#include "replay.h"
+
+#include <string.h>
+#include <time.h>
+
+static const unsigned char REPLAY_MAGIC[4] = {'D', 'D', 'R', 'P'};
+
+static void put_le(unsigned char *bytes, uint64_t value, int count) {
+    for (int i = 0; i < count; i++) {
+        bytes[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static uint64_t get_le(const unsigned char *bytes, int count) {
+    uint64_t value = 0;
+    for (int i = 0; i < count; i++) {
+        value |= (uint64_t)bytes[i] << (8 * i);
+    }
+    return value;
+}
+
+bool replay_open_record(replay_ptr replay, const char *path) {
+    memset(replay, 0, sizeof(*replay));
+
+    replay->file = fopen(path, "wb");
+    if (!replay->file) {
+        printf("Failed to create replay %s\n", path);
+        return false;
+    }
+
+    replay->mode = REPLAY_RECORD;
+    replay->path = path;
+    return true;
+}
+
+bool replay_open_playback(replay_ptr replay, const char *path) {
+    memset(replay, 0, sizeof(*replay));
+
+    replay->file = fopen(path, "rb");
+    if (!replay->file) {
+        printf("Failed to open replay %s\n", path);
+        return false;
+    }
+
+    unsigned char header[20];
+    if (fread(header, sizeof(header), 1, replay->file) != 1 || memcmp(header, REPLAY_MAGIC, 4) != 0 ||
+        get_le(header + 4, 4) != REPLAY_VERSION) {
+        printf("%s is not a version %d replay\n", path, REPLAY_VERSION);
+        fclose(replay->file);
+        replay->file = NULL;
+        return false;
+    }
+
+    replay->mode = REPLAY_PLAYBACK;
+    replay->path = path;
+    replay->seed = (uint32_t)get_le(header + 8, 4);
+    replay->start_time = (timestamp_ms_t)get_le(header + 12, 8);
+    return true;
+}
+
+bool replay_begin_session(replay_ptr replay, timestamp_ms_t current_time) {
+    if (replay->mode == REPLAY_OFF || replay->started) {
+        return false;
+    }
+
+    if (replay->mode == REPLAY_RECORD) {
+        replay->seed = (uint32_t)time(NULL);
+        replay->start_time = current_time;
+
+        unsigned char header[20];
+        memcpy(header, REPLAY_MAGIC, 4);
+        put_le(header + 4, REPLAY_VERSION, 4);
+        put_le(header + 8, replay->seed, 4);
+        put_le(header + 12, replay->start_time, 8);
+        fwrite(header, sizeof(header), 1, replay->file);
+    }
+
+    replay->last_time = replay->start_time;
+    replay->started = true;
+    return true;
+}
+
+void replay_record_tick(replay_ptr replay, timestamp_ms_t current_time, uint8_t input) {
+    // Steps rather than absolute times; a 32-bit step still covers a window left in the background for weeks
+    timestamp_ms_t step = current_time > replay->last_time ? current_time - replay->last_time : 0;
+
+    unsigned char record[5];
+    record[0] = input;
+    put_le(record + 1, step, 4);
+    fwrite(record, sizeof(record), 1, replay->file);
+
+    replay->last_time = current_time;
+    replay->ticks++;
+}
+
+bool replay_read_tick(replay_ptr replay, timestamp_ms_t *current_time, uint8_t *input) {
+    unsigned char record[5];
+    if (fread(record, sizeof(record), 1, replay->file) != 1) {
+        return false;
+    }
+
+    replay->last_time += (timestamp_ms_t)get_le(record + 1, 4);
+    replay->ticks++;
+    *current_time = replay->last_time;
+    *input = record[0];
+    return true;
+}
+
+void replay_close(replay_ptr replay) {
+    if (replay->file) {
+        fclose(replay->file);
+        printf("Replay %s: %llu ticks %s\n", replay->path, (unsigned long long)replay->ticks,
+               replay->mode == REPLAY_RECORD ? "recorded" : "played back");
+    }
+
+    replay->file = NULL;
+    replay->mode = REPLAY_OFF;
+}
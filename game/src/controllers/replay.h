@@ -0,0 +1,105 @@
+/**
+ * @file replay.h
+ * @brief Recording and playback of a playing session's input
+ *
+ * A replay holds everything the simulation takes from outside: the rand()
+ * seed and clock the session started on, then for every tick the player's
+ * keys and the clock step since the previous tick. Recording starts the
+ * session from a fresh seeded layout, so playing the file back through the
+ * same build reproduces the session tick for tick, as fast or as slowly as
+ * the caller steps it.
+ *
+ * File layout (little-endian): "DDRP", version (u32), seed (u32), start
+ * time (u64), then five bytes per tick: input flags (u8) and clock step
+ * in milliseconds (u32).
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "types.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define REPLAY_VERSION 1
+
+// Player input flags stored per tick
+#define PLAYER_INPUT_LEFT 0x01
+#define PLAYER_INPUT_RIGHT 0x02
+#define PLAYER_INPUT_FIRE 0x04
+
+/**
+ * Replay direction
+ */
+typedef enum {
+    REPLAY_OFF,     // Live play, nothing recorded
+    REPLAY_RECORD,  // Live play, every tick written to the file
+    REPLAY_PLAYBACK // Clock and input come from the file
+} replay_mode_t;
+
+/**
+ * Replay file being recorded or played back
+ */
+typedef struct {
+    replay_mode_t mode;        // Direction (REPLAY_OFF once the session is over)
+    FILE *file;                // Open replay file
+    const char *path;          // File name, for messages
+    bool started;              // The session has begun (header written or consumed)
+    uint32_t seed;             // rand() seed the session starts from
+    timestamp_ms_t start_time; // Clock at the start of the session
+    timestamp_ms_t last_time;  // Clock of the previous tick
+    uint64_t ticks;            // Ticks recorded or played back so far
+} replay_t;
+
+// Pointer typedef for replay
+typedef replay_t *replay_ptr;
+
+/**
+ * @brief Open a file to record the next playing session into
+ * @param replay Replay to initialize
+ * @param path File to create
+ * @return true if successful
+ */
+bool replay_open_record(replay_ptr replay, const char *path);
+
+/**
+ * @brief Open a recorded session for playback
+ * @param replay Replay to initialize
+ * @param path File to read
+ * @return true if the file is a replay of this version
+ */
+bool replay_open_playback(replay_ptr replay, const char *path);
+
+/**
+ * @brief Start the session: pick and write the seed and start clock, or take them from the file
+ * @param replay Replay
+ * @param current_time Clock when recording starts (ignored on playback)
+ * @return true if a session began (seed and start_time are then valid), false if there is nothing to begin
+ */
+bool replay_begin_session(replay_ptr replay, timestamp_ms_t current_time);
+
+/**
+ * @brief Append one tick to the recording
+ * @param replay Replay being recorded
+ * @param current_time Clock for this tick
+ * @param input Player input flags for this tick
+ */
+void replay_record_tick(replay_ptr replay, timestamp_ms_t current_time, uint8_t input);
+
+/**
+ * @brief Read the next tick of the playback
+ * @param replay Replay being played back
+ * @param current_time Receives the clock for this tick
+ * @param input Receives the player input flags for this tick
+ * @return false once the recording is exhausted
+ */
+bool replay_read_tick(replay_ptr replay, timestamp_ms_t *current_time, uint8_t *input);
+
+/**
+ * @brief Finish the session and close the file (later sessions are live)
+ * @param replay Replay
+ */
+void replay_close(replay_ptr replay);
+
+#endif // REPLAY_H
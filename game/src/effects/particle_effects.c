@@ -0,0 +1,52 @@
+/**
+ * @file particle_effects.c
+ * @brief Particle bursts for gameplay events implementation
+ */
+
+#include "particle_effects.h"
+#include "crab.h"
+#include "duck.h"
+#include "event_system.h"
+#include "game_events.h"
+
+// Orange and red sparks thrown out of a destroyed crab
+static const particle_burst_t CRAB_DESTROYED_BURST = {
+    .count = 48,
+    .min_speed = 0.8f,
+    .max_speed = 3.2f,
+    .upward_bias = 1.0f,
+    .min_life_ticks = 25,
+    .max_life_ticks = 50,
+    .colors = {{255, 200, 40, 255}, {255, 120, 20, 255}, {230, 40, 20, 255}, {255, 255, 160, 255}},
+    .color_count = 4,
+};
+
+// White and yellow feathers left behind by the duck
+static const particle_burst_t DUCK_DIED_BURST = {
+    .count = 96,
+    .min_speed = 0.5f,
+    .max_speed = 2.5f,
+    .upward_bias = 1.5f,
+    .min_life_ticks = 40,
+    .max_life_ticks = 80,
+    .colors = {{255, 255, 255, 255}, {240, 240, 220, 255}, {255, 220, 60, 255}},
+    .color_count = 3,
+};
+
+static void on_crab_destroyed(const game_event_t *event, void *user_data) {
+    game_ptr game = (game_ptr)user_data;
+    const crab_destroyed_data_t *data = (const crab_destroyed_data_t *)event->data;
+    particle_system_emit(&game->particles, &CRAB_DESTROYED_BURST, data->x + CRAB_WIDTH / 2.0f,
+                         data->y + CRAB_HEIGHT / 2.0f);
+}
+
+static void on_duck_died(const game_event_t *event, void *user_data) {
+    game_ptr game = (game_ptr)user_data;
+    const duck_died_data_t *data = (const duck_died_data_t *)event->data;
+    particle_system_emit(&game->particles, &DUCK_DIED_BURST, data->x + DUCK_WIDTH / 2.0f, data->y + DUCK_HEIGHT / 2.0f);
+}
+
+void subscribe_particle_events(game_ptr game) {
+    subscribe(&game->event_system, GAME_EVENT_CRAB_DESTROYED, on_crab_destroyed, game);
+    subscribe(&game->event_system, GAME_EVENT_DUCK_DIED, on_duck_died, game);
+}
@@ -0,0 +1,26 @@
+/**
+ * @file particle_effects.h
+ * @brief Particle bursts for gameplay events
+ *
+ * Spawns hit sparks when a crab is destroyed and a cloud of feathers when
+ * the duck dies, driven by the game event system.
+ */
+
+#ifndef GAME_SRC_EFFECTS_PARTICLE_EFFECTS_H_
+#define GAME_SRC_EFFECTS_PARTICLE_EFFECTS_H_
+
+#include "game.h"
+
+// Particle system sizing and motion
+#define PARTICLE_CAPACITY 32768 // Live particles at most (bursts beyond this are truncated)
+#define PARTICLE_GRAVITY 0.12f  // Downward acceleration (pixels per tick squared)
+#define PARTICLE_SIZE 2.0f      // Edge of each particle square in pixels
+
+/**
+ * Subscribe to game events that spawn particle bursts
+ *
+ * @param game Game state
+ */
+void subscribe_particle_events(game_ptr game);
+
+#endif // GAME_SRC_EFFECTS_PARTICLE_EFFECTS_H_
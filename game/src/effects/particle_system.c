@@ -0,0 +1,264 @@
+/**
+ * @file particle_system.c
+ * @brief Pooled structure-of-arrays particle system implementation
+ */
+
+#include "particle_system.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+#define PARTICLE_ALIGNMENT 64   // Float arrays start on cache line boundaries
+#define PARTICLE_FLOAT_ARRAYS 6 // x, y, vx, vy, life, decay
+#define PARTICLE_TWO_PI 6.28318530718f
+#define PARTICLE_DEFAULT_SEED 0x9e3779b9u
+
+static uint32_t next_random(particle_system_ptr system) {
+    // xorshift32: cheap, and independent of the gameplay rand() sequence
+    uint32_t state = system->random_state;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    system->random_state = state;
+    return state;
+}
+
+static float random_unit(particle_system_ptr system) {
+    // Top 24 bits give every float in [0, 1) the same spacing
+    return (float)(next_random(system) >> 8) * (1.0f / 16777216.0f);
+}
+
+bool particle_system_init(particle_system_ptr system, size_t capacity, float gravity, float floor_y, float size,
+                          uint32_t seed) {
+    memset(system, 0, sizeof(*system));
+
+    if (capacity == 0) {
+        return false;
+    }
+
+    // Whole vectors only, so the kernels never need a masked tail at the end of an array
+    capacity = (capacity + PARTICLE_LANES - 1) / PARTICLE_LANES * PARTICLE_LANES;
+
+    // Over-allocate so the float arrays can start on a cache line boundary
+    system->block = malloc(PARTICLE_FLOAT_ARRAYS * capacity * sizeof(float) + PARTICLE_ALIGNMENT - 1);
+    system->colors = malloc(capacity * sizeof(SDL_Color));
+    system->vertices = malloc(capacity * 4 * sizeof(SDL_Vertex));
+    system->indices = malloc(capacity * 6 * sizeof(int));
+    if (!system->block || !system->colors || !system->vertices || !system->indices) {
+        particle_system_destroy(system);
+        return false;
+    }
+
+    uintptr_t aligned = ((uintptr_t)system->block + PARTICLE_ALIGNMENT - 1) & ~(uintptr_t)(PARTICLE_ALIGNMENT - 1);
+    float *arrays = (float *)aligned;
+    memset(arrays, 0, PARTICLE_FLOAT_ARRAYS * capacity * sizeof(float));
+    system->x = arrays;
+    system->y = arrays + capacity;
+    system->vx = arrays + 2 * capacity;
+    system->vy = arrays + 3 * capacity;
+    system->life = arrays + 4 * capacity;
+    system->decay = arrays + 5 * capacity;
+
+    // Every quad is two triangles over its four corners; only the corners change per frame
+    for (size_t i = 0; i < capacity; i++) {
+        int corner = (int)(i * 4);
+        int *quad = &system->indices[i * 6];
+        quad[0] = corner;
+        quad[1] = corner + 1;
+        quad[2] = corner + 2;
+        quad[3] = corner + 2;
+        quad[4] = corner + 3;
+        quad[5] = corner;
+    }
+
+    system->capacity = capacity;
+    system->gravity = gravity;
+    system->floor_y = floor_y;
+    system->size = size;
+    system->random_state = seed != 0 ? seed : PARTICLE_DEFAULT_SEED;
+    return true;
+}
+
+int particle_system_emit(particle_system_ptr system, const particle_burst_t *burst, float x, float y) {
+    size_t room = system->capacity - system->count;
+    size_t spawned = (size_t)burst->count < room ? (size_t)burst->count : room;
+    int life_range = burst->max_life_ticks - burst->min_life_ticks + 1;
+    float half_size = system->size * 0.5f;
+
+    for (size_t n = 0; n < spawned; n++) {
+        size_t i = system->count++;
+
+        float angle = random_unit(system) * PARTICLE_TWO_PI;
+        float speed = burst->min_speed + random_unit(system) * (burst->max_speed - burst->min_speed);
+        int life_ticks = burst->min_life_ticks + (int)(next_random(system) % (uint32_t)life_range);
+
+        system->x[i] = x - half_size;
+        system->y[i] = y - half_size;
+        system->vx[i] = cosf(angle) * speed;
+        system->vy[i] = sinf(angle) * speed - burst->upward_bias;
+        system->life[i] = 1.0f;
+        system->decay[i] = 1.0f / (float)(life_ticks > 0 ? life_ticks : 1);
+        system->colors[i] = burst->colors[next_random(system) % (uint32_t)burst->color_count];
+    }
+
+    if (system->count > system->peak_count) {
+        system->peak_count = system->count;
+    }
+    return (int)spawned;
+}
+
+static void integrate(particle_system_ptr system) {
+    size_t count = system->count;
+    float *x = system->x;
+    float *y = system->y;
+    float *vx = system->vx;
+    float *vy = system->vy;
+    float *life = system->life;
+    const float *decay = system->decay;
+    size_t i = 0;
+
+#if defined(__SSE__)
+    const __m128 gravity = _mm_set1_ps(system->gravity);
+    for (; i + 4 <= count; i += 4) {
+        __m128 velocity_y = _mm_add_ps(_mm_load_ps(&vy[i]), gravity);
+        _mm_store_ps(&vy[i], velocity_y);
+        _mm_store_ps(&x[i], _mm_add_ps(_mm_load_ps(&x[i]), _mm_load_ps(&vx[i])));
+        _mm_store_ps(&y[i], _mm_add_ps(_mm_load_ps(&y[i]), velocity_y));
+        _mm_store_ps(&life[i], _mm_sub_ps(_mm_load_ps(&life[i]), _mm_load_ps(&decay[i])));
+    }
+#endif
+
+    // Remaining particles (all of them without SSE, where the compiler vectorizes this loop itself)
+    for (; i < count; i++) {
+        vy[i] += system->gravity;
+        x[i] += vx[i];
+        y[i] += vy[i];
+        life[i] -= decay[i];
+    }
+}
+
+static unsigned dead_lanes(const particle_system_t *system, size_t base) {
+    // Bit n is set when particle base + n has faded out or fallen below the floor
+#if defined(__SSE__)
+    __m128 faded = _mm_cmple_ps(_mm_load_ps(&system->life[base]), _mm_setzero_ps());
+    __m128 fallen = _mm_cmpgt_ps(_mm_load_ps(&system->y[base]), _mm_set1_ps(system->floor_y));
+    return (unsigned)_mm_movemask_ps(_mm_or_ps(faded, fallen));
+#else
+    unsigned mask = 0;
+    for (unsigned lane = 0; lane < 4; lane++) {
+        if (system->life[base + lane] <= 0.0f || system->y[base + lane] > system->floor_y) {
+            mask |= 1u << lane;
+        }
+    }
+    return mask;
+#endif
+}
+
+static void kill_particle(particle_system_ptr system, size_t i) {
+    // The last live particle takes over the slot so the live range stays packed
+    size_t last = --system->count;
+    system->x[i] = system->x[last];
+    system->y[i] = system->y[last];
+    system->vx[i] = system->vx[last];
+    system->vy[i] = system->vy[last];
+    system->life[i] = system->life[last];
+    system->decay[i] = system->decay[last];
+    system->colors[i] = system->colors[last];
+}
+
+static void cull(particle_system_ptr system) {
+    // Walk backwards in groups of four: every particle moved into a freed slot comes from
+    // behind the cursor and has already been checked, and all-alive groups are skipped at once
+    size_t end = system->count;
+    while (end > 0) {
+        size_t base = (end - 1) & ~(size_t)3;
+        unsigned mask = dead_lanes(system, base) & ((1u << (end - base)) - 1u);
+
+        for (size_t i = end; mask != 0 && i-- > base;) {
+            if (mask & (1u << (i - base))) {
+                kill_particle(system, i);
+            }
+        }
+        end = base;
+    }
+}
+
+void particle_system_update(particle_system_ptr system) {
+    if (system->count == 0) {
+        return;
+    }
+
+    integrate(system);
+    cull(system);
+}
+
+void particle_system_render(particle_system_ptr system, graphics_context_t *graphics_context) {
+    if (system->count == 0) {
+        return;
+    }
+
+    const float size = system->size;
+    for (size_t i = 0; i < system->count; i++) {
+        float left = system->x[i];
+        float top = system->y[i];
+        SDL_Color color = system->colors[i];
+        color.a = (Uint8)(system->life[i] * 255.0f); // Fade out over the particle's life
+
+        SDL_Vertex *corner = &system->vertices[i * 4];
+        corner[0] = (SDL_Vertex){{left, top}, color, {0.0f, 0.0f}};
+        corner[1] = (SDL_Vertex){{left + size, top}, color, {0.0f, 0.0f}};
+        corner[2] = (SDL_Vertex){{left + size, top + size}, color, {0.0f, 0.0f}};
+        corner[3] = (SDL_Vertex){{left, top + size}, color, {0.0f, 0.0f}};
+    }
+
+    // Untextured geometry is blended with the renderer's draw blend mode
+    SDL_Renderer *renderer = graphics_context->renderer;
+    SDL_BlendMode previous_mode;
+    SDL_GetRenderDrawBlendMode(renderer, &previous_mode);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(renderer, NULL, system->vertices, (int)(system->count * 4), system->indices,
+                       (int)(system->count * 6));
+    SDL_SetRenderDrawBlendMode(renderer, previous_mode);
+}
+
+void particle_system_render_software(const particle_system_t *system, soft_framebuffer_ptr framebuffer) {
+    const float size = system->size;
+    for (size_t i = 0; i < system->count; i++) {
+        // A pixel is covered when its center falls inside the quad, as when the GPU rasterizes it
+        int left = (int)ceilf(system->x[i] - 0.5f);
+        int top = (int)ceilf(system->y[i] - 0.5f);
+        int right = (int)ceilf(system->x[i] + size - 0.5f);
+        int bottom = (int)ceilf(system->y[i] + size - 0.5f);
+
+        SDL_Color color = system->colors[i];
+        color.a = (Uint8)(system->life[i] * 255.0f);
+        soft_blend_rect(framebuffer, left, top, right - left, bottom - top, color);
+    }
+}
+
+void particle_system_copy_live(particle_system_ptr destination, const particle_system_t *source) {
+    size_t count = source->count < destination->capacity ? source->count : destination->capacity;
+
+    // Velocities and decay only matter to updates, which the copy never gets
+    memcpy(destination->x, source->x, count * sizeof(float));
+    memcpy(destination->y, source->y, count * sizeof(float));
+    memcpy(destination->life, source->life, count * sizeof(float));
+    memcpy(destination->colors, source->colors, count * sizeof(SDL_Color));
+    destination->count = count;
+    destination->size = source->size;
+}
+
+void particle_system_clear(particle_system_ptr system) { system->count = 0; }
+
+void particle_system_destroy(particle_system_ptr system) {
+    free(system->block);
+    free(system->colors);
+    free(system->vertices);
+    free(system->indices);
+    memset(system, 0, sizeof(*system));
+}
@@ -0,0 +1,139 @@
+/**
+ * @file particle_system.h
+ * @brief Pooled structure-of-arrays particle system
+ *
+ * Short-lived cosmetic particles (hit sparks, feathers) are stored as
+ * parallel arrays of positions, velocities and remaining life, packed at
+ * the front of one aligned allocation. A tick updates every particle with
+ * a vectorized kernel (four lanes at a time where SSE is available) and
+ * then culls dead ones by moving the last live particle into their slot,
+ * so the live range never has holes. All live particles are drawn as one
+ * batch of colored quads in a single geometry call.
+ *
+ * Particles never feed back into the simulation and draw from their own
+ * random generator, so spawning them does not disturb gameplay randomness.
+ */
+
+#ifndef GAME_SRC_EFFECTS_PARTICLE_SYSTEM_H_
+#define GAME_SRC_EFFECTS_PARTICLE_SYSTEM_H_
+
+#include "graphics.h"
+#include "soft_raster.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Arrays are padded to whole vectors of this many floats
+#define PARTICLE_LANES 8
+
+/**
+ * Appearance and motion of one burst of particles
+ */
+typedef struct {
+    int count;           // Particles emitted by the burst
+    float min_speed;     // Slowest launch speed (pixels per tick)
+    float max_speed;     // Fastest launch speed (pixels per tick)
+    float upward_bias;   // Subtracted from the launch vertical velocity
+    int min_life_ticks;  // Shortest lifetime (ticks)
+    int max_life_ticks;  // Longest lifetime (ticks)
+    SDL_Color colors[4]; // Each particle picks one of these
+    int color_count;     // Number of entries used in colors
+} particle_burst_t;
+
+/**
+ * Particle system (structure of arrays, live particles in [0, count))
+ */
+typedef struct {
+    float *x;              // Left edge
+    float *y;              // Top edge
+    float *vx;             // Horizontal velocity (pixels per tick)
+    float *vy;             // Vertical velocity (pixels per tick)
+    float *life;           // Remaining life, 1 at spawn and dead at 0
+    float *decay;          // Life lost per tick
+    SDL_Color *colors;     // Base color, faded by remaining life when drawn
+    void *block;           // Raw allocation backing the float arrays
+    SDL_Vertex *vertices;  // Four corners per particle, rebuilt every draw
+    int *indices;          // Two triangles per particle, built once
+    size_t count;          // Live particles
+    size_t capacity;       // Maximum live particles (multiple of PARTICLE_LANES)
+    float gravity;         // Added to vy every tick
+    float floor_y;         // Particles below this line are culled
+    float size;            // Edge of the square drawn for each particle
+    uint32_t random_state; // Private xorshift state
+    size_t peak_count;     // Highest live count seen (telemetry)
+} particle_system_t;
+
+// Pointer typedef for particle system
+typedef particle_system_t *particle_system_ptr;
+
+/**
+ * @brief Allocate a particle system
+ * @param system Particle system to initialize
+ * @param capacity Maximum number of live particles (rounded up to PARTICLE_LANES)
+ * @param gravity Downward acceleration in pixels per tick squared
+ * @param floor_y Particles falling below this line are culled
+ * @param size Edge of the square drawn for each particle
+ * @param seed Seed for the private random generator (0 is replaced by a fixed value)
+ * @return true if successful
+ */
+bool particle_system_init(particle_system_ptr system, size_t capacity, float gravity, float floor_y, float size,
+                          uint32_t seed);
+
+/**
+ * @brief Spawn a burst of particles around a point
+ *
+ * Particles beyond the remaining capacity are dropped.
+ *
+ * @param system Particle system
+ * @param burst Burst description
+ * @param x Center of the burst
+ * @param y Center of the burst
+ * @return Number of particles actually spawned
+ */
+int particle_system_emit(particle_system_ptr system, const particle_burst_t *burst, float x, float y);
+
+/**
+ * @brief Advance every particle by one tick and cull the dead ones
+ * @param system Particle system
+ */
+void particle_system_update(particle_system_ptr system);
+
+/**
+ * @brief Draw every live particle in a single batched geometry call
+ * @param system Particle system
+ * @param graphics_context Graphics context to draw into
+ */
+void particle_system_render(particle_system_ptr system, graphics_context_t *graphics_context);
+
+/**
+ * @brief Draw every live particle into a CPU framebuffer, covering the pixels the GPU path covers
+ * @param system Particle system
+ * @param framebuffer Framebuffer to draw into
+ */
+void particle_system_render_software(const particle_system_t *system, soft_framebuffer_ptr framebuffer);
+
+/**
+ * @brief Copy what drawing needs of the live particles (position, life, color) into another system
+ *
+ * Lets a snapshot be drawn while the source keeps updating. Particles
+ * beyond the destination's capacity are dropped.
+ *
+ * @param destination Particle system to draw from
+ * @param source Particle system being simulated
+ */
+void particle_system_copy_live(particle_system_ptr destination, const particle_system_t *source);
+
+/**
+ * @brief Kill every particle at once
+ * @param system Particle system
+ */
+void particle_system_clear(particle_system_ptr system);
+
+/**
+ * @brief Free the memory owned by the particle system
+ * @param system Particle system
+ */
+void particle_system_destroy(particle_system_ptr system);
+
+#endif // GAME_SRC_EFFECTS_PARTICLE_SYSTEM_H_
@@ -6,48 +6,67 @@
 #include "brick.h"
 #include "types.h"
 
-bool brick_spawn(object_pool_t *pool, float x, float y) {
+static void on_brick_expired(timer_wheel_ptr timers, void *context, timestamp_ms_t current_time) {
+    (void)timers;
+    (void)current_time;
+
+    // Released once it reaches the head of the ring
+    brick_ptr brick = (brick_ptr)context;
+    brick->expire_timer = TIMER_HANDLE_INVALID;
+    brick->active = false;
+}
+
+bool brick_spawn(ring_pool_t *pool, motion_event_queue_ptr events, sim_tick_t tick, sim_scalar_t x, sim_scalar_t y,
+                 int lake_start_y) {
     size_t index;
-    brick_ptr brick = (brick_ptr)pool_acquire(pool, &index);
+    brick_ptr brick = (brick_ptr)ring_pool_acquire(pool, &index);
     if (!brick) {
-        return false; // Pool is full
+        return false; // Ring is full
     }
 
     brick->active = true;
     brick->landed = false;
     brick->x = x;
-    brick->y = y;
-    brick->land_time = 0;
+    brick->motion = linear_motion(y, SIM_FROM_FLOAT(BRICK_FALL_SPEED), tick);
+    brick->expire_timer = TIMER_HANDLE_INVALID;
+
+    // Lands when its bottom edge reaches the lake surface
+    sim_scalar_t rest_y = SIM_FROM_INT(lake_start_y - BRICK_HEIGHT);
+    brick->land_event =
+        motion_event_schedule(events, motion_tick_reaching(&brick->motion, rest_y), MOTION_EVENT_BRICK_LAND, brick);
     return true;
 }
 
-void bricks_update_all(object_pool_t *pool, int lake_start_y, timestamp_ms_t current_time) {
-    // Manual iteration since we need to potentially release objects
-    for (size_t i = 0; i < pool->capacity; i++) {
-        if (!pool_is_active(pool, i))
-            continue;
+void brick_handle_land(brick_ptr brick, motion_event_id_t event_id, timer_wheel_ptr timers, sim_tick_t tick,
+                       int lake_start_y, timestamp_ms_t current_time) {
+    if (!brick->active || brick->land_event != event_id) {
+        return; // Slot was released or reused since the event was queued
+    }
 
-        brick_ptr brick = (brick_ptr)pool_get_at(pool, i);
-        if (!brick || !brick->active)
-            continue;
+    brick->land_event = MOTION_EVENT_NONE;
+    brick->landed = true;
+    brick->motion = linear_motion(SIM_FROM_INT(lake_start_y - BRICK_HEIGHT), 0, tick); // Rest on lake surface
+
+    // The wheel clears active when the landed timeout passes; no per-tick time check
+    brick->expire_timer = timer_wheel_schedule(timers, current_time + BRICK_LAND_DURATION, on_brick_expired, brick);
+}
 
-        if (!brick->landed) {
-            // Fall downward
-            brick->y += BRICK_FALL_SPEED;
-
-            // Check if brick reaches lake surface
-            if (brick->y + BRICK_HEIGHT >= lake_start_y) {
-                brick->landed = true;
-                brick->y = lake_start_y - BRICK_HEIGHT; // Position on lake surface
-                brick->land_time = current_time;
-            }
-        } else {
-            // Check if timeout has passed
-            if (current_time - brick->land_time >= BRICK_LAND_DURATION) {
-                brick->active = false;
-                brick->landed = false;
-                pool_release(pool, i);
-            }
+void bricks_update_all(ring_pool_t *pool, timer_wheel_ptr timers) {
+    // Oldest to newest in each segment; stop at the first brick still falling or lying on the lake, then try the
+    // next segment
+    ring_pool_iter_t iter = ring_pool_iter(pool);
+    while (ring_pool_iter_next(&iter)) {
+        brick_ptr brick = (brick_ptr)iter.element;
+        if (brick->active) {
+            ring_pool_iter_skip_segment(&iter);
+            continue;
         }
+
+        // The slot will be reused, so neither its timer nor its event may fire into it
+        timer_wheel_cancel(timers, brick->expire_timer);
+        brick->expire_timer = TIMER_HANDLE_INVALID;
+        brick->land_event = MOTION_EVENT_NONE;
+        brick->landed = false;
+        ring_pool_iter_release(&iter);
     }
 }
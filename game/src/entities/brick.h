@@ -1,12 +1,18 @@
 /**
  * @file brick.h
  * @brief Brick entity (dropped by crabs)
+ *
+ * A falling brick's height is a linear motion evaluated on demand; the tick
+ * it reaches the lake is queued as a motion event when it is dropped.
  */
 
 #ifndef GAME_ENTITIES_BRICK_H_
 #define GAME_ENTITIES_BRICK_H_
 
-#include "object_pool.h"
+#include "kinematics.h"
+#include "motion_events.h"
+#include "ring_pool.h"
+#include "timer_wheel.h"
 #include "types.h"
 #include <stdbool.h>
 
@@ -14,11 +20,12 @@
  * Brick structure
  */
 typedef struct {
-    float x;                  // X position
-    float y;                  // Y position
-    bool active;              // True if brick is falling or landed
-    bool landed;              // True if brick has landed on lake surface
-    timestamp_ms_t land_time; // When brick landed (for timeout)
+    sim_scalar_t x;               // X position
+    linear_motion_t motion;       // Vertical motion (at rest once landed)
+    bool active;                  // True if brick is falling or landed (cleared when the landed timeout fires)
+    bool landed;                  // True if brick has landed on lake surface
+    motion_event_id_t land_event; // Pending landing event
+    timer_handle_t expire_timer;  // Landed timeout, armed on landing
 } brick_t;
 
 // Pointer typedef for brick
@@ -29,27 +36,58 @@ typedef brick_t *brick_ptr;
 #define BRICK_HEIGHT 5        // Sprite height
 #define BRICK_FALL_SPEED 6.0f // Fall speed
 
-// Pool size and timing
-#define MAX_BRICKS 10            // Maximum number of falling bricks on screen
+// Ring pool size and timing (bricks expire roughly in the order they were dropped; segments chain as they fill)
+#define BRICK_RING_SEGMENT 16    // Brick slots per ring segment
+#define MAX_BRICKS_CAPACITY 80   // Upper bound on falling and landed bricks
 #define BRICK_LAND_DURATION 4000 // Bricks stay on lake for 4 seconds
 
 /**
- * Spawn a falling brick using object pool
+ * Y position of a brick at a simulation tick
+ *
+ * @param brick Brick
+ * @param tick Simulation tick
+ * @return Y position
+ */
+static inline sim_scalar_t brick_y(const brick_t *brick, sim_tick_t tick) {
+    return motion_position(&brick->motion, tick);
+}
+
+/**
+ * Spawn a falling brick at the tail of the brick ring and queue its landing
  *
- * @param pool Object pool for bricks
+ * @param pool Ring pool for bricks
+ * @param events Motion event queue
+ * @param tick Current simulation tick
  * @param x Starting X position
  * @param y Starting Y position
- * @return true if spawned successfully, false if pool is full
+ * @param lake_start_y Y position of lake surface
+ * @return true if spawned successfully, false if the ring is full
  */
-bool brick_spawn(object_pool_t *pool, float x, float y);
+bool brick_spawn(ring_pool_t *pool, motion_event_queue_ptr events, sim_tick_t tick, sim_scalar_t x, sim_scalar_t y,
+                 int lake_start_y);
 
 /**
- * Update all bricks using object pool (falling and landed timeout)
+ * Handle a brick reaching the lake surface
  *
- * @param pool Object pool for bricks
+ * @param brick Brick the event was queued for
+ * @param event_id Id of the popped event (stale events are ignored)
+ * @param timers Timer wheel the landed timeout is armed on
+ * @param tick Current simulation tick
  * @param lake_start_y Y position of lake surface
  * @param current_time Current game time
  */
-void bricks_update_all(object_pool_t *pool, int lake_start_y, timestamp_ms_t current_time);
+void brick_handle_land(brick_ptr brick, motion_event_id_t event_id, timer_wheel_ptr timers, sim_tick_t tick,
+                       int lake_start_y, timestamp_ms_t current_time);
+
+/**
+ * Release expired bricks from the head of the ring
+ *
+ * A brick expiring out of order stays in the ring, inactive, until every
+ * older brick is gone.
+ *
+ * @param pool Ring pool for bricks
+ * @param timers Timer wheel the landed timeout is armed on
+ */
+void bricks_update_all(ring_pool_t *pool, timer_wheel_ptr timers);
 
 #endif // GAME_ENTITIES_BRICK_H_
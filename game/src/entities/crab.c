@@ -7,36 +7,113 @@
 #include "clock.h"
 #include <stdlib.h>
 
-void crabs_update_all(object_pool_t *crab_pool, object_pool_t *brick_pool, int logical_width,
-                      timestamp_ms_t current_time, void (*play_sound_callback)(void *, int), void *sound_context) {
-    // Manual iteration since we need to access all crabs
-    for (size_t i = 0; i < crab_pool->capacity; i++) {
-        if (!pool_is_active(crab_pool, i))
-            continue;
+static void on_drop_due(timer_wheel_ptr timers, void *context, timestamp_ms_t current_time) {
+    (void)timers;
+    (void)current_time;
 
-        crab_ptr crab = (crab_ptr)pool_get_at(crab_pool, i);
-        if (!crab || !crab->alive)
-            continue;
+    crab_ptr crab = (crab_ptr)context;
+    crab->drop_timer = TIMER_HANDLE_INVALID;
+    crab->drop_ready = true;
+}
+
+static void on_drop_finished(timer_wheel_ptr timers, void *context, timestamp_ms_t current_time) {
+    crab_ptr crab = (crab_ptr)context;
+    crab->drop_timer = TIMER_HANDLE_INVALID;
+    crab->dropping = false;
+
+    // Set next drop time (3-8 seconds from now)
+    crab_schedule_drop(crab, timers, current_time + CRAB_DROP_DELAY_MIN_MS + (rand() % CRAB_DROP_DELAY_RANGE_MS));
+}
+
+void crab_schedule_drop(crab_ptr crab, timer_wheel_ptr timers, timestamp_ms_t deadline) {
+    timer_wheel_cancel(timers, crab->drop_timer);
+    crab->drop_ready = false;
+    crab->drop_timer = timer_wheel_schedule(timers, deadline, on_drop_due, crab);
+}
+
+void crab_schedule_wrap(crab_ptr crab, motion_event_queue_ptr events, int logical_width) {
+    // Fully off screen past the edge it walks towards
+    sim_scalar_t edge = crab->motion.velocity > 0 ? SIM_FROM_INT(logical_width) : SIM_FROM_INT(-CRAB_WIDTH);
+    crab->wrap_event =
+        motion_event_schedule(events, motion_tick_beyond(&crab->motion, edge), MOTION_EVENT_CRAB_WRAP, crab);
+}
+
+void crab_handle_wrap(crab_ptr crab, motion_event_queue_ptr events, motion_event_id_t event_id,
+                      sprite_animation_system_ptr animations, int *crabs_with_bricks, int logical_width,
+                      sim_tick_t tick, timestamp_ms_t current_time) {
+    if (!crab->alive || crab->wrap_event != event_id) {
+        return; // Destroyed or its slot reused since the event was queued
+    }
+
+    // Crab gets brick when it goes off-screen (max 6 crabs with bricks)
+    if (!crab->has_brick && !crab->dropping) {
+        // Only give brick if less than max (count is maintained on pickup and drop)
+        if (*crabs_with_bricks < MAX_CRABS_WITH_BRICKS) {
+            crab->has_brick = true;
+            (*crabs_with_bricks)++;
+            sprite_animation_play(animations, crab->animation, ANIMATION_CLIP_CRAB_CARRY, current_time);
+        }
+    }
+
+    // Wrap around screen edges (seamless wrapping)
+    sim_scalar_t x = crab->motion.velocity > 0 ? SIM_FROM_INT(-CRAB_WIDTH) : SIM_FROM_INT(logical_width);
+    crab->motion = linear_motion(x, crab->motion.velocity, tick);
+    crab_schedule_wrap(crab, events, logical_width);
+}
 
-        // Update dropping animation
-        if (crab->dropping) {
-            if (current_time - crab->drop_start_time > DROP_ANIM_DURATION) {
-                crab->dropping = false;
+void crabs_update_all(entity_pool_t *crab_pool, ring_pool_t *brick_pool, timer_wheel_ptr timers,
+                      sprite_animation_system_ptr animations, motion_event_queue_ptr events, int *crabs_with_bricks,
+                      int logical_width, int lake_start_y, sim_tick_t tick, timestamp_ms_t current_time,
+                      void (*play_sound_callback)(void *, int), void *sound_context) {
+    size_t cursor = 0;
+    crabs_update_slice(crab_pool, &cursor, crab_pool->active_count, brick_pool, timers, animations, events,
+                       crabs_with_bricks, logical_width, lake_start_y, tick, current_time, play_sound_callback,
+                       sound_context);
+}
+
+void crabs_update_slice(entity_pool_t *crab_pool, size_t *cursor, size_t budget, ring_pool_t *brick_pool,
+                        timer_wheel_ptr timers, sprite_animation_system_ptr animations, motion_event_queue_ptr events,
+                        int *crabs_with_bricks, int logical_width, int lake_start_y, sim_tick_t tick,
+                        timestamp_ms_t current_time, void (*play_sound_callback)(void *, int), void *sound_context) {
+    // Prefetching iterator resuming where the previous slice stopped
+    entity_pool_iter_t iter = entity_pool_iter_at(crab_pool, *cursor);
+    size_t visited = 0;
+    while (visited < budget && entity_pool_iter_next(&iter)) {
+        visited++;
+        crab_ptr crab = (crab_ptr)iter.element;
+        if (!crab->alive) {
+            // A destroyed crab's brick goes down with it
+            if (crab->has_brick) {
                 crab->has_brick = false;
-                // Set next drop time (3-8 seconds from now)
-                crab->next_drop_time = current_time + 3000 + (rand() % 5000);
+                (*crabs_with_bricks)--;
             }
+
+            // The slot is about to be reused, so neither its timer nor its wrap event may fire into it
+            timer_wheel_cancel(timers, crab->drop_timer);
+            crab->drop_timer = TIMER_HANDLE_INVALID;
+            crab->wrap_event = MOTION_EVENT_NONE;
+            sprite_animation_release(animations, crab->animation);
+            crab->animation = SPRITE_ANIMATION_NONE;
+
+            // Destroyed crabs go back to the pool so later ticks only visit live ones
+            entity_pool_iter_release(&iter);
+            continue;
         }
 
         // Check if it's time to drop brick AND crab is in central 80% of screen
-        float drop_zone_start = logical_width * 0.1f; // 10% from left
-        float drop_zone_end = logical_width * 0.9f;   // 10% from right
-        bool in_drop_zone = crab->x >= drop_zone_start && crab->x + CRAB_WIDTH <= drop_zone_end;
+        sim_scalar_t drop_zone_start = SIM_FROM_INT(logical_width) / 10;   // 10% from left
+        sim_scalar_t drop_zone_end = SIM_FROM_INT(logical_width) / 10 * 9; // 10% from right
+        sim_scalar_t x = crab_x(crab, tick);
+        bool in_drop_zone = x >= drop_zone_start && x + SIM_FROM_INT(CRAB_WIDTH) <= drop_zone_end;
 
-        if (crab->has_brick && !crab->dropping && current_time >= crab->next_drop_time && in_drop_zone) {
-            // Start dropping animation
+        if (crab->has_brick && !crab->dropping && crab->drop_ready && in_drop_zone) {
+            // Start dropping animation; the brick leaves the crab right away
             crab->dropping = true;
-            crab->drop_start_time = current_time;
+            crab->drop_ready = false;
+            crab->has_brick = false;
+            (*crabs_with_bricks)--;
+            crab->drop_timer = timer_wheel_schedule(timers, current_time + DROP_ANIM_DURATION, on_drop_finished, crab);
+            sprite_animation_play(animations, crab->animation, ANIMATION_CLIP_CRAB_DROP, current_time);
 
             // Play brick drop sound
             if (play_sound_callback && sound_context) {
@@ -44,46 +121,13 @@ void crabs_update_all(object_pool_t *crab_pool, object_pool_t *brick_pool, int l
             }
 
             // Spawn a falling brick
-            brick_spawn(brick_pool,
-                        crab->x + (CRAB_WIDTH / 2) - 6, // Center under crab
-                        crab->y + CRAB_HEIGHT);         // Below crab
-        }
-
-        // Move crab
-        crab->x += crab->vx;
-
-        // Check if crab is fully off screen (for brick pickup)
-        if (crab->x < -CRAB_WIDTH || crab->x > logical_width) {
-            if (!crab->off_screen) {
-                crab->off_screen = true;
-                // Crab gets brick when it goes off-screen (max 6 crabs with bricks)
-                if (!crab->has_brick) {
-                    // Count how many crabs currently have bricks
-                    int crabs_with_bricks = 0;
-                    for (size_t j = 0; j < crab_pool->capacity; j++) {
-                        if (!pool_is_active(crab_pool, j))
-                            continue;
-                        crab_ptr other_crab = (crab_ptr)pool_get_at(crab_pool, j);
-                        if (other_crab && other_crab->has_brick) {
-                            crabs_with_bricks++;
-                        }
-                    }
-                    // Only give brick if less than max
-                    if (crabs_with_bricks < MAX_CRABS_WITH_BRICKS) {
-                        crab->has_brick = true;
-                    }
-                }
-            }
-        } else if (crab->off_screen) {
-            // Coming back on screen
-            crab->off_screen = false;
-        }
-
-        // Wrap around screen edges (seamless wrapping)
-        if (crab->x < -CRAB_WIDTH) {
-            crab->x = logical_width;
-        } else if (crab->x > logical_width) {
-            crab->x = -CRAB_WIDTH;
+            brick_spawn(brick_pool, events, tick,
+                        x + SIM_FROM_INT(CRAB_WIDTH / 2 - 6), // Center under crab
+                        crab->y + SIM_FROM_INT(CRAB_HEIGHT),  // Below crab
+                        lake_start_y);
         }
     }
+
+    // Start over from the first crab once the end of the live list is reached
+    *cursor = iter.next < crab_pool->active_count ? iter.next : 0;
 }
@@ -1,12 +1,21 @@
 /**
  * @file crab.h
  * @brief Crab enemy entity
+ *
+ * Crabs walk at a constant speed and wrap at the screen edges, so their
+ * horizontal position is a linear motion evaluated on demand. The tick a
+ * crab walks off the screen (where it wraps and may pick up a brick) is
+ * queued as a motion event.
  */
 
 #ifndef GAME_ENTITIES_CRAB_H_
 #define GAME_ENTITIES_CRAB_H_
 
-#include "object_pool.h"
+#include "entity_pool.h"
+#include "kinematics.h"
+#include "motion_events.h"
+#include "sprite_animation.h"
+#include "timer_wheel.h"
 #include "types.h"
 #include <stdbool.h>
 
@@ -16,16 +25,16 @@
  * Crab enemy structure
  */
 typedef struct {
-    float x;                        // X position
-    float y;                        // Y position
-    float vx;                       // Velocity X (horizontal movement)
-    bool moving_right;              // True if moving right, false if moving left
-    bool alive;                     // True if crab is alive, false if hit
-    bool has_brick;                 // True if crab is carrying a brick
-    bool off_screen;                // True if crab has gone off screen
-    bool dropping;                  // True if crab is currently dropping brick
-    timestamp_ms_t drop_start_time; // When brick drop animation started
-    timestamp_ms_t next_drop_time;  // When crab will drop next brick
+    linear_motion_t motion;          // Horizontal motion
+    sim_scalar_t y;                  // Y position
+    bool moving_right;               // True if moving right, false if moving left
+    bool alive;                      // True if crab is alive, false if hit
+    bool has_brick;                  // True if crab is carrying a brick
+    motion_event_id_t wrap_event;    // Pending off-screen wrap event
+    bool dropping;                   // True if crab is currently dropping brick
+    bool drop_ready;                 // True once the drop delay has elapsed (set by drop_timer)
+    timer_handle_t drop_timer;       // Pending drop delay or drop animation timer
+    sprite_animation_id_t animation; // Walk, carry and drop animation
 } crab_t;
 
 // Pointer typedef for crab
@@ -36,7 +45,8 @@ typedef crab_t *crab_ptr;
 #define CRAB_HEIGHT (15 * 2) // Crab sprite height at 2x scale
 
 // Pool size and limits
-#define NUM_CRABS 10            // Number of crabs on screen
+#define NUM_CRABS 10            // Number of crabs on screen (also the crab pool chunk size)
+#define MAX_CRABS_CAPACITY 1024 // Upper bound on crabs for stress-scale waves
 #define MAX_CRABS_WITH_BRICKS 6 // Maximum crabs carrying bricks at once
 
 // Movement constants
@@ -46,17 +56,102 @@ typedef crab_t *crab_ptr;
 // Animation timing
 #define DROP_ANIM_DURATION 100 // Dropping animation duration in ms
 
+// Brick drop delay (random between min and min + range)
+#define CRAB_DROP_DELAY_MIN_MS 3000
+#define CRAB_DROP_DELAY_RANGE_MS 5000
+
+/**
+ * X position of a crab at a simulation tick
+ *
+ * @param crab Crab
+ * @param tick Simulation tick
+ * @return X position
+ */
+static inline sim_scalar_t crab_x(const crab_t *crab, sim_tick_t tick) {
+    return motion_position(&crab->motion, tick);
+}
+
+/**
+ * Queue the tick at which a crab walks fully off the screen
+ *
+ * @param crab Crab to schedule (must stay at the same address until the event fires or goes stale)
+ * @param events Motion event queue
+ * @param logical_width Screen width for bounds checking
+ */
+void crab_schedule_wrap(crab_ptr crab, motion_event_queue_ptr events, int logical_width);
+
+/**
+ * Handle a crab walking off the screen: it may pick up a brick, then re-enters at the other edge
+ *
+ * @param crab Crab the event was queued for
+ * @param events Motion event queue the next wrap is queued on
+ * @param event_id Id of the popped event (stale events are ignored)
+ * @param animations Animation system playing the crab clips
+ * @param crabs_with_bricks Running count of crabs carrying a brick
+ * @param logical_width Screen width for bounds checking
+ * @param tick Current simulation tick
+ * @param current_time Current game time
+ */
+void crab_handle_wrap(crab_ptr crab, motion_event_queue_ptr events, motion_event_id_t event_id,
+                      sprite_animation_system_ptr animations, int *crabs_with_bricks, int logical_width,
+                      sim_tick_t tick, timestamp_ms_t current_time);
+
+/**
+ * Arm the timer that lets a crab drop its next brick
+ *
+ * @param crab Crab to schedule (must stay at the same address until the timer fires or is cancelled)
+ * @param timers Timer wheel
+ * @param deadline Time from which the crab may drop a brick
+ */
+void crab_schedule_drop(crab_ptr crab, timer_wheel_ptr timers, timestamp_ms_t deadline);
+
+/**
+ * Update all crabs using object pool (brick dropping)
+ * Crabs destroyed since the last update are released back to the pool;
+ * movement and wrapping are analytic and need no per-crab work here
+ *
+ * @param crab_pool Object pool for crabs
+ * @param brick_pool Ring pool for spawning dropped bricks
+ * @param timers Timer wheel driving drop delays and drop animations
+ * @param animations Animation system playing the crab clips
+ * @param events Motion event queue dropped bricks queue their landing on
+ * @param crabs_with_bricks Running count of crabs carrying a brick (updated on pickup and drop)
+ * @param logical_width Screen width for bounds checking
+ * @param lake_start_y Y position of lake surface (where dropped bricks land)
+ * @param tick Current simulation tick
+ * @param current_time Current game time
+ * @param play_sound_callback Callback to play brick drop sound
+ * @param sound_context Audio context for sound callback
+ */
+void crabs_update_all(entity_pool_t *crab_pool, ring_pool_t *brick_pool, timer_wheel_ptr timers,
+                      sprite_animation_system_ptr animations, motion_event_queue_ptr events, int *crabs_with_bricks,
+                      int logical_width, int lake_start_y, sim_tick_t tick, timestamp_ms_t current_time,
+                      void (*play_sound_callback)(void *, int), void *sound_context);
+
 /**
- * Update all crabs using object pool (movement, animations, brick dropping)
+ * Update the next slice of crabs (same work as crabs_update_all)
+ * Visits up to budget crabs in live list order starting at *cursor, so
+ * calling it every tick with a fraction of the population spreads the
+ * upkeep of large crab counts evenly across ticks
  *
  * @param crab_pool Object pool for crabs
- * @param brick_pool Object pool for spawning dropped bricks
+ * @param cursor Live list position to resume from, advanced past the crabs visited (wraps to 0 at the end)
+ * @param budget Maximum number of crabs to visit
+ * @param brick_pool Ring pool for spawning dropped bricks
+ * @param timers Timer wheel driving drop delays and drop animations
+ * @param animations Animation system playing the crab clips
+ * @param events Motion event queue dropped bricks queue their landing on
+ * @param crabs_with_bricks Running count of crabs carrying a brick (updated on pickup and drop)
  * @param logical_width Screen width for bounds checking
+ * @param lake_start_y Y position of lake surface (where dropped bricks land)
+ * @param tick Current simulation tick
  * @param current_time Current game time
  * @param play_sound_callback Callback to play brick drop sound
  * @param sound_context Audio context for sound callback
  */
-void crabs_update_all(object_pool_t *crab_pool, object_pool_t *brick_pool, int logical_width,
-                      timestamp_ms_t current_time, void (*play_sound_callback)(void *, int), void *sound_context);
+void crabs_update_slice(entity_pool_t *crab_pool, size_t *cursor, size_t budget, ring_pool_t *brick_pool,
+                        timer_wheel_ptr timers, sprite_animation_system_ptr animations, motion_event_queue_ptr events,
+                        int *crabs_with_bricks, int logical_width, int lake_start_y, sim_tick_t tick,
+                        timestamp_ms_t current_time, void (*play_sound_callback)(void *, int), void *sound_context);
 
 #endif // GAME_ENTITIES_CRAB_H_
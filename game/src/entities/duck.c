@@ -12,6 +12,8 @@
 
 // Private helper functions
 static void duck_update_shooting(duck_ptr duck);
+static void duck_on_shoot_finished(timer_wheel_ptr timers, void *context, timestamp_ms_t current_time);
+static void duck_on_respawn(timer_wheel_ptr timers, void *context, timestamp_ms_t current_time);
 static void duck_init_extended(duck_ptr duck);
 static void duck_init_bounds(duck_ptr self, float x, float y, float bounds_min_x, float bounds_max_x);
 static bool duck_is_shooting(const duck_ptr self);
@@ -21,19 +23,22 @@ static bool duck_is_alive(const duck_ptr self);
 // PROCEDURAL INTERFACE (Backward Compatibility)
 // =============================================================================
 
-void duck_init(duck_ptr duck, float x, float y) {
+void duck_init(duck_ptr duck, sim_scalar_t x, sim_scalar_t y) {
     if (!duck)
         return;
 
     // Initialize basic state
     duck->x = x;
     duck->y = y;
-    duck->vx = 0.0f;
+    duck->vx = 0;
     duck->facing_right = true;
     duck->shooting = false;
     duck->shoot_start_time = 0;
+    duck->shoot_timer = TIMER_HANDLE_INVALID;
     duck->dead = false;
     duck->death_time = 0;
+    duck->respawn_timer = TIMER_HANDLE_INVALID;
+    duck->animation = SPRITE_ANIMATION_NONE;
 
     // Initialize extended state with defaults (wide bounds for backward compatibility)
     duck_init_extended(duck);
@@ -49,20 +54,45 @@ void duck_update(duck_ptr duck) {
     // Simple boundary checking without stopping velocity
     if (duck->x < 0) {
         duck->x = 0;
-    } else if (duck->x + DUCK_WIDTH > LOGICAL_WIDTH) {
-        duck->x = LOGICAL_WIDTH - DUCK_WIDTH;
+    } else if (duck->x + SIM_FROM_INT(DUCK_WIDTH) > SIM_FROM_INT(LOGICAL_WIDTH)) {
+        duck->x = SIM_FROM_INT(LOGICAL_WIDTH - DUCK_WIDTH);
     }
+}
+
+void duck_shoot(duck_ptr duck, timer_wheel_ptr timers, sprite_animation_system_ptr animations,
+                timestamp_ms_t current_time) {
+    if (!duck)
+        return;
+
+    duck->shooting = true;
+    duck->shoot_start_time = current_time;
+    sprite_animation_play(animations, duck->animation, ANIMATION_CLIP_DUCK_SHOOTING, current_time);
+
+    // Holding fire keeps pushing the end of the pose back
+    timer_wheel_cancel(timers, duck->shoot_timer);
+    duck->shoot_timer = timer_wheel_schedule(timers, current_time + DUCK_SHOOT_DURATION, duck_on_shoot_finished, duck);
+}
+
+void duck_kill(duck_ptr duck, timer_wheel_ptr timers, sprite_animation_system_ptr animations,
+               timestamp_ms_t current_time) {
+    if (!duck)
+        return;
+
+    duck->dead = true;
+    duck->death_time = current_time;
+    sprite_animation_play(animations, duck->animation, ANIMATION_CLIP_DUCK_DEAD, current_time);
 
-    duck_update_shooting(duck);
+    timer_wheel_cancel(timers, duck->respawn_timer);
+    duck->respawn_timer = timer_wheel_schedule(timers, current_time + DUCK_RESPAWN_DELAY, duck_on_respawn, duck);
 }
 
-void duck_respawn(duck_ptr duck, float x, float y) {
+void duck_respawn(duck_ptr duck, sim_scalar_t x, sim_scalar_t y) {
     if (!duck)
         return;
 
     duck->x = x;
     duck->y = y;
-    duck->vx = 0.0f;
+    duck->vx = 0;
     duck->facing_right = true;
     duck->shooting = false;
     duck->dead = false;
@@ -91,13 +121,13 @@ static void duck_init_bounds(duck_ptr self, float x, float y, float bounds_min_x
         return;
 
     // Initialize basic state using procedural function
-    duck_init(self, x, y);
+    duck_init(self, SIM_FROM_FLOAT(x), SIM_FROM_FLOAT(y));
 
     // Set Object-oriented specific state
-    self->bounds_min_x = bounds_min_x;
-    self->bounds_max_x = bounds_max_x;
+    self->bounds_min_x = SIM_FROM_FLOAT(bounds_min_x);
+    self->bounds_max_x = SIM_FROM_FLOAT(bounds_max_x);
     self->health = DUCK_DEFAULT_HEALTH;
-    self->max_speed = DUCK_SPEED * 1.5f; // Allow slightly faster than default
+    self->max_speed = SIM_FROM_FLOAT(DUCK_SPEED * 1.5f); // Allow slightly faster than default
 }
 
 void duck_destroy(duck_ptr self) {
@@ -114,14 +144,14 @@ void duck_update_enhanced(duck_ptr self, float delta_time) {
     duck_update_shooting(self);
 
     // Apply enhanced movement with delta time
-    self->x += self->vx * delta_time;
+    self->x += SIM_FROM_FLOAT(SIM_TO_FLOAT(self->vx) * delta_time);
 
     // Enhanced boundary checking with stopping
     if (self->x < self->bounds_min_x) {
         self->x = self->bounds_min_x;
         self->vx = 0; // Stop at boundary
-    } else if (self->x + DUCK_WIDTH > self->bounds_max_x) {
-        self->x = self->bounds_max_x - DUCK_WIDTH;
+    } else if (self->x + SIM_FROM_INT(DUCK_WIDTH) > self->bounds_max_x) {
+        self->x = self->bounds_max_x - SIM_FROM_INT(DUCK_WIDTH);
         self->vx = 0; // Stop at boundary
     }
 }
@@ -131,18 +161,19 @@ void duck_set_velocity(duck_ptr self, float velocity_x) {
         return;
 
     // Clamp to max speed
-    if (velocity_x > self->max_speed) {
-        velocity_x = self->max_speed;
-    } else if (velocity_x < -self->max_speed) {
-        velocity_x = -self->max_speed;
+    sim_scalar_t velocity = SIM_FROM_FLOAT(velocity_x);
+    if (velocity > self->max_speed) {
+        velocity = self->max_speed;
+    } else if (velocity < -self->max_speed) {
+        velocity = -self->max_speed;
     }
 
-    self->vx = velocity_x;
+    self->vx = velocity;
 
     // Update facing direction
-    if (velocity_x > 0) {
+    if (velocity > 0) {
         self->facing_right = true;
-    } else if (velocity_x < 0) {
+    } else if (velocity < 0) {
         self->facing_right = false;
     }
 }
@@ -151,13 +182,13 @@ void duck_move(duck_ptr self, float dx) {
     if (!self || !duck_is_alive(self))
         return;
 
-    self->x += dx;
+    self->x += SIM_FROM_FLOAT(dx);
 
     // Apply boundary checking
     if (self->x < self->bounds_min_x) {
         self->x = self->bounds_min_x;
-    } else if (self->x + DUCK_WIDTH > self->bounds_max_x) {
-        self->x = self->bounds_max_x - DUCK_WIDTH;
+    } else if (self->x + SIM_FROM_INT(DUCK_WIDTH) > self->bounds_max_x) {
+        self->x = self->bounds_max_x - SIM_FROM_INT(DUCK_WIDTH);
     }
 }
 
@@ -206,8 +237,8 @@ void duck_set_bounds(duck_ptr self, float min_x, float max_x) {
     if (!self)
         return;
 
-    self->bounds_min_x = min_x;
-    self->bounds_max_x = max_x;
+    self->bounds_min_x = SIM_FROM_FLOAT(min_x);
+    self->bounds_max_x = SIM_FROM_FLOAT(max_x);
 }
 
 // =============================================================================
@@ -218,18 +249,18 @@ void duck_get_position(const duck_ptr self, float *x, float *y) {
     if (!self || !x || !y)
         return;
 
-    *x = self->x;
-    *y = self->y;
+    *x = SIM_TO_FLOAT(self->x);
+    *y = SIM_TO_FLOAT(self->y);
 }
 
-float duck_get_velocity(const duck_ptr self) { return self ? self->vx : 0.0f; }
+float duck_get_velocity(const duck_ptr self) { return self ? SIM_TO_FLOAT(self->vx) : 0.0f; }
 
 void duck_get_bounds(const duck_ptr self, float *x, float *y, float *width, float *height) {
     if (!self || !x || !y || !width || !height)
         return;
 
-    *x = self->x;
-    *y = self->y;
+    *x = SIM_TO_FLOAT(self->x);
+    *y = SIM_TO_FLOAT(self->y);
     *width = DUCK_WIDTH;
     *height = DUCK_HEIGHT;
 }
@@ -246,7 +277,7 @@ bool duck_is_within_bounds(const duck_ptr self) {
     if (!self)
         return false;
 
-    return (self->x >= self->bounds_min_x && self->x + DUCK_WIDTH <= self->bounds_max_x);
+    return (self->x >= self->bounds_min_x && self->x + SIM_FROM_INT(DUCK_WIDTH) <= self->bounds_max_x);
 }
 
 // =============================================================================
@@ -263,13 +294,31 @@ static void duck_update_shooting(duck_ptr duck) {
     }
 }
 
+static void duck_on_shoot_finished(timer_wheel_ptr timers, void *context, timestamp_ms_t current_time) {
+    (void)timers;
+    (void)current_time;
+
+    duck_ptr duck = (duck_ptr)context;
+    duck->shoot_timer = TIMER_HANDLE_INVALID;
+    duck->shooting = false;
+}
+
+static void duck_on_respawn(timer_wheel_ptr timers, void *context, timestamp_ms_t current_time) {
+    (void)timers;
+    (void)current_time;
+
+    duck_ptr duck = (duck_ptr)context;
+    duck->respawn_timer = TIMER_HANDLE_INVALID;
+    duck_respawn(duck, SIM_FROM_INT(LOGICAL_WIDTH) / 2, SIM_FROM_INT(LAKE_START_Y - DUCK_HEIGHT));
+}
+
 static void duck_init_extended(duck_ptr duck) {
     if (!duck)
         return;
 
     // Set reasonable defaults for Object-oriented features
     duck->bounds_min_x = 0;
-    duck->bounds_max_x = LOGICAL_WIDTH; // Use actual screen width
+    duck->bounds_max_x = SIM_FROM_INT(LOGICAL_WIDTH); // Use actual screen width
     duck->health = DUCK_DEFAULT_HEALTH;
-    duck->max_speed = DUCK_SPEED * 1.5f;
+    duck->max_speed = SIM_FROM_FLOAT(DUCK_SPEED * 1.5f);
 }
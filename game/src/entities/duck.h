@@ -9,6 +9,9 @@
 #ifndef GAME_ENTITIES_DUCK_H_
 #define GAME_ENTITIES_DUCK_H_
 
+#include "sim_scalar.h"
+#include "sprite_animation.h"
+#include "timer_wheel.h"
 #include "types.h"
 #include <stdbool.h>
 
@@ -20,24 +23,29 @@
  */
 typedef struct duck_t {
     // Position and movement
-    float x;           // X position
-    float y;           // Y position
-    float vx;          // Velocity X
+    sim_scalar_t x;    // X position
+    sim_scalar_t y;    // Y position
+    sim_scalar_t vx;   // Velocity X
     bool facing_right; // True if facing right, false if facing left
 
     // Combat state
     bool shooting;                   // True if currently shooting
     timestamp_ms_t shoot_start_time; // When shooting started
+    timer_handle_t shoot_timer;      // Ends the shooting pose (procedural interface)
 
     // Life state
-    bool dead;                 // True if duck is dead
-    timestamp_ms_t death_time; // When duck died
+    bool dead;                    // True if duck is dead
+    timestamp_ms_t death_time;    // When duck died
+    timer_handle_t respawn_timer; // Respawns the duck (procedural interface)
+
+    // Presentation
+    sprite_animation_id_t animation; // Pose animation (procedural interface)
 
     // Extended Object-oriented state (optional)
-    float bounds_min_x; // Left movement boundary
-    float bounds_max_x; // Right movement boundary
-    int health;         // Health points (0 = dead)
-    float max_speed;    // Maximum movement speed
+    sim_scalar_t bounds_min_x; // Left movement boundary
+    sim_scalar_t bounds_max_x; // Right movement boundary
+    int health;                // Health points (0 = dead)
+    sim_scalar_t max_speed;    // Maximum movement speed
 } duck_t;
 
 // Pointer typedef for duck
@@ -49,6 +57,7 @@ typedef duck_t *duck_ptr;
 #define DUCK_SPEED 4.0f         // Default movement speed
 #define DUCK_SHOOT_DURATION 100 // Shooting animation duration in ms
 #define DUCK_DEFAULT_HEALTH 3   // Default health points
+#define DUCK_RESPAWN_DELAY 2000 // Time from death to respawn in ms
 
 // =============================================================================
 // PROCEDURAL INTERFACE (Backward Compatibility)
@@ -61,15 +70,39 @@ typedef duck_t *duck_ptr;
  * @param x Starting X position
  * @param y Starting Y position
  */
-void duck_init(duck_ptr duck, float x, float y);
+void duck_init(duck_ptr duck, sim_scalar_t x, sim_scalar_t y);
 
 /**
  * Update duck state (procedural interface)
+ * The shooting pose is ended by the timer armed in duck_shoot
  *
  * @param duck Duck to update
  */
 void duck_update(duck_ptr duck);
 
+/**
+ * Start (or extend) the shooting pose (procedural interface)
+ *
+ * @param duck Duck that shoots
+ * @param timers Timer wheel the end of the pose is scheduled on
+ * @param animations Animation system playing the duck's pose
+ * @param current_time Current game time
+ */
+void duck_shoot(duck_ptr duck, timer_wheel_ptr timers, sprite_animation_system_ptr animations,
+                timestamp_ms_t current_time);
+
+/**
+ * Kill the duck and schedule its respawn at the starting position (procedural interface)
+ * The dead pose lasts DUCK_RESPAWN_DELAY and then hands back to the idle pose
+ *
+ * @param duck Duck to kill
+ * @param timers Timer wheel the respawn is scheduled on
+ * @param animations Animation system playing the duck's pose
+ * @param current_time Current game time
+ */
+void duck_kill(duck_ptr duck, timer_wheel_ptr timers, sprite_animation_system_ptr animations,
+               timestamp_ms_t current_time);
+
 /**
  * Respawn duck after death (procedural interface)
  *
@@ -77,7 +110,7 @@ void duck_update(duck_ptr duck);
  * @param x Respawn X position
  * @param y Respawn Y position
  */
-void duck_respawn(duck_ptr duck, float x, float y);
+void duck_respawn(duck_ptr duck, sim_scalar_t x, sim_scalar_t y);
 
 // =============================================================================
 // OBJECT-ORIENTED INTERFACE (Enhanced)
@@ -1,62 +1,104 @@
 /**
  * @file jellyfish.c
- * @brief Jellyfish enemy implementation
+ * @brief Jellyfish formation implementation
  */
 
 #include "jellyfish.h"
-#include "clock.h"
 
-void jellyfish_update_all(object_pool_t *pool, int logical_width, timestamp_ms_t current_time) {
-    // Check if any jellyfish hit the edge (all bounce together)
-    bool should_bounce = false;
-    bool new_direction = false;
+static void refresh_member_positions(jellyfish_formation_ptr formation) {
+    // One add per member; independent lanes so the loop vectorizes
+    const sim_scalar_t x = formation->x;
+    const sim_scalar_t y = formation->y;
+    for (int i = 0; i < formation->member_count; i++) {
+        formation->member_x[i] = x + formation->member_dx[i];
+        formation->member_y[i] = y + formation->member_dy[i];
+    }
+}
 
-    for (size_t i = 0; i < pool->capacity; i++) {
-        if (!pool_is_active(pool, i))
-            continue;
+void jellyfish_formation_init(jellyfish_formation_ptr formation, sim_scalar_t x, sim_scalar_t y,
+                              sim_scalar_t group_velocity_x, bool moving_right, sim_tick_t tick) {
+    formation->x = x;
+    formation->y = y;
+    formation->motion = linear_motion(x, group_velocity_x, tick);
+    formation->bounce_event = MOTION_EVENT_NONE;
+    formation->moving_right = moving_right;
+    formation->width = 0;
+    formation->height = 0;
+    formation->member_count = 0;
+}
 
-        jellyfish_ptr jellyfish = (jellyfish_ptr)pool_get_at(pool, i);
-        if (!jellyfish)
-            continue;
+bool jellyfish_formation_add_member(jellyfish_formation_ptr formation, sim_scalar_t dx, sim_scalar_t dy,
+                                    int anim_offset) {
+    if (formation->member_count >= NUM_JELLYFISH) {
+        return false; // Formation is full
+    }
 
-        float new_x = jellyfish->x + jellyfish->vx;
+    int member = formation->member_count++;
+    formation->member_dx[member] = dx;
+    formation->member_dy[member] = dy;
+    formation->member_anim_offset[member] = anim_offset % JELLYFISH_FRAME_COUNT;
+    formation->member_animation[member] = SPRITE_ANIMATION_NONE;
 
-        if (new_x < 0 || new_x + JELLYFISH_WIDTH > logical_width) {
-            should_bounce = true;
-            new_direction = new_x < 0; // true = moving right, false = moving left
-            break;
-        }
+    // Grow the bounding box to cover the new member
+    if (dx + SIM_FROM_INT(JELLYFISH_WIDTH) > formation->width) {
+        formation->width = dx + SIM_FROM_INT(JELLYFISH_WIDTH);
+    }
+    if (dy + SIM_FROM_INT(JELLYFISH_HEIGHT) > formation->height) {
+        formation->height = dy + SIM_FROM_INT(JELLYFISH_HEIGHT);
     }
 
-    // Update all jellyfish together
-    for (size_t i = 0; i < pool->capacity; i++) {
-        if (!pool_is_active(pool, i))
-            continue;
+    refresh_member_positions(formation);
+    return true;
+}
 
-        jellyfish_ptr jellyfish = (jellyfish_ptr)pool_get_at(pool, i);
-        if (!jellyfish)
-            continue;
+void jellyfish_formation_start_animation(jellyfish_formation_ptr formation, sprite_animation_system_ptr animations,
+                                         timestamp_ms_t current_time) {
+    for (int i = 0; i < formation->member_count; i++) {
+        uint32_t phase_offset_ms = (uint32_t)(formation->member_anim_offset[i] * ANIMATION_CYCLE_MS);
+        formation->member_animation[i] =
+            sprite_animation_create(animations, ANIMATION_CLIP_JELLYFISH_SWIM, phase_offset_ms, current_time);
+    }
+}
 
-        if (should_bounce) {
-            // All jellyfish reverse direction together
-            jellyfish->vx = -jellyfish->vx;
-            jellyfish->moving_right = new_direction;
-        }
+void jellyfish_formation_schedule_bounce(jellyfish_formation_ptr formation, motion_event_queue_ptr events,
+                                         int logical_width) {
+    if (formation->member_count == 0) {
+        return;
+    }
 
-        // Move jellyfish
-        jellyfish->x += jellyfish->vx;
+    // The whole formation bounces when its bounding box would leave the screen
+    sim_scalar_t edge = formation->motion.velocity > 0 ? SIM_FROM_INT(logical_width) - formation->width : 0;
+    formation->bounce_event = motion_event_schedule(events, motion_tick_beyond(&formation->motion, edge),
+                                                    MOTION_EVENT_JELLYFISH_BOUNCE, formation);
+}
+
+void jellyfish_formation_handle_bounce(jellyfish_formation_ptr formation, motion_event_queue_ptr events,
+                                       motion_event_id_t event_id, int logical_width, sim_tick_t tick) {
+    if (formation->bounce_event != event_id) {
+        return; // Formation was rebuilt since the event was queued
+    }
+
+    // Reverse from where the formation was before the move that would have left the screen
+    sim_scalar_t vx = -formation->motion.velocity;
+    sim_scalar_t x = motion_position(&formation->motion, tick - 1) + vx;
+    formation->moving_right = vx > 0;
 
-        // Clamp to screen bounds
-        if (jellyfish->x < 0) {
-            jellyfish->x = 0;
-        } else if (jellyfish->x + JELLYFISH_WIDTH > logical_width) {
-            jellyfish->x = logical_width - JELLYFISH_WIDTH;
-        }
+    // Clamp to screen bounds
+    if (x < 0) {
+        x = 0;
+    } else if (x + formation->width > SIM_FROM_INT(logical_width)) {
+        x = SIM_FROM_INT(logical_width) - formation->width;
+    }
+
+    formation->motion = linear_motion(x, vx, tick);
+    jellyfish_formation_schedule_bounce(formation, events, logical_width);
+}
 
-        // Animate jellyfish
-        if (current_time - jellyfish->last_anim_time >= ANIMATION_CYCLE_MS) {
-            jellyfish->anim_frame = (jellyfish->anim_frame + 1) % JELLYFISH_FRAME_COUNT;
-            jellyfish->last_anim_time = current_time;
-        }
+void jellyfish_formation_update(jellyfish_formation_ptr formation, sim_tick_t tick) {
+    if (formation->member_count == 0) {
+        return;
     }
+
+    formation->x = motion_position(&formation->motion, tick);
+    refresh_member_positions(formation);
 }
@@ -1,30 +1,25 @@
 /**
  * @file jellyfish.h
- * @brief Jellyfish enemy entity
+ * @brief Jellyfish enemy formation
+ *
+ * Jellyfish always move and bounce together, so they are simulated as one
+ * formation: a group origin, velocity and bounding box, with every member
+ * stored as an offset from the origin. The origin moves as a linear motion
+ * and the tick its bounding box next hits a screen edge is queued as a
+ * motion event, so bouncing costs nothing between bounces. Member world
+ * positions are refreshed in one vectorizable pass. Each member plays the
+ * swim clip in the animation system, staggered by its frame offset.
  */
 
 #ifndef GAME_ENTITIES_JELLYFISH_H_
 #define GAME_ENTITIES_JELLYFISH_H_
 
-#include "object_pool.h"
+#include "kinematics.h"
+#include "motion_events.h"
+#include "sprite_animation.h"
 #include "types.h"
 #include <stdbool.h>
 
-/**
- * Jellyfish enemy structure
- */
-typedef struct {
-    float x;                       // X position
-    float y;                       // Y position
-    float vx;                      // Velocity X (horizontal movement)
-    bool moving_right;             // True if moving right, false if moving left
-    int anim_frame;                // Current animation frame (0-3)
-    timestamp_ms_t last_anim_time; // Last animation frame change time
-} jellyfish_t;
-
-// Pointer typedef for jellyfish
-typedef jellyfish_t *jellyfish_ptr;
-
 // Jellyfish sprite dimensions (2x scale)
 #define JELLYFISH_WIDTH (16 * 2)  // Wider frame at 2x scale
 #define JELLYFISH_HEIGHT (13 * 2) // Jellyfish sprite height at 2x scale
@@ -37,17 +32,97 @@ typedef jellyfish_t *jellyfish_ptr;
 #define JELLYFISH_FRAME_COUNT 4 // Number of animation frames
 #define ANIMATION_CYCLE_MS 250  // Time per animation frame in milliseconds
 
-// Pool size
+// Formation size
 #define NUM_JELLYFISH 4 // Number of jellyfish on screen
 
 /**
- * Update all jellyfish using object pool (movement and animation)
- * Note: All jellyfish move together and bounce together
+ * Jellyfish formation structure
+ */
+typedef struct {
+    sim_scalar_t x;                 // Formation origin X (left edge of the bounding box) at the last update
+    sim_scalar_t y;                 // Formation origin Y (top edge of the bounding box)
+    linear_motion_t motion;         // Horizontal motion of the origin
+    motion_event_id_t bounce_event; // Pending edge bounce event
+    bool moving_right;              // True if moving right, false if moving left
+    sim_scalar_t width;             // Bounding box width covering all members
+    sim_scalar_t height;            // Bounding box height covering all members
+
+    // Members (structure of arrays)
+    int member_count;
+    sim_scalar_t member_dx[NUM_JELLYFISH];                 // Offset from the formation origin
+    sim_scalar_t member_dy[NUM_JELLYFISH];                 // Offset from the formation origin
+    int member_anim_offset[NUM_JELLYFISH];                 // Frame offset so members don't animate in lockstep
+    sprite_animation_id_t member_animation[NUM_JELLYFISH]; // Swim animation of each member
+    sim_scalar_t member_x[NUM_JELLYFISH];                  // World X, refreshed after every move
+    sim_scalar_t member_y[NUM_JELLYFISH];                  // World Y, refreshed after every move
+} jellyfish_formation_t;
+
+// Pointer typedef for jellyfish formation
+typedef jellyfish_formation_t *jellyfish_formation_ptr;
+
+/**
+ * Initialize an empty formation
  *
- * @param pool Object pool for jellyfish
- * @param logical_width Screen width for bounds checking
+ * @param formation Formation to initialize
+ * @param x Formation origin X
+ * @param y Formation origin Y
+ * @param group_velocity_x Velocity shared by all members
+ * @param moving_right Direction of movement
+ * @param tick Simulation tick the formation starts moving at
+ */
+void jellyfish_formation_init(jellyfish_formation_ptr formation, sim_scalar_t x, sim_scalar_t y,
+                              sim_scalar_t group_velocity_x, bool moving_right, sim_tick_t tick);
+
+/**
+ * Add a member to the formation and grow its bounding box
+ *
+ * @param formation Formation to extend
+ * @param dx Member X offset from the origin (non-negative)
+ * @param dy Member Y offset from the origin (non-negative)
+ * @param anim_offset Animation frame offset for this member
+ * @return true if added, false if the formation is full
+ */
+bool jellyfish_formation_add_member(jellyfish_formation_ptr formation, sim_scalar_t dx, sim_scalar_t dy,
+                                    int anim_offset);
+
+/**
+ * Start the swim animation of every member, staggered by its frame offset
+ *
+ * @param formation Jellyfish formation
+ * @param animations Animation system
  * @param current_time Current game time for animation
  */
-void jellyfish_update_all(object_pool_t *pool, int logical_width, timestamp_ms_t current_time);
+void jellyfish_formation_start_animation(jellyfish_formation_ptr formation, sprite_animation_system_ptr animations,
+                                         timestamp_ms_t current_time);
+
+/**
+ * Queue the tick at which the formation next hits a screen edge
+ *
+ * @param formation Jellyfish formation (all members added)
+ * @param events Motion event queue
+ * @param logical_width Screen width for bounds checking
+ */
+void jellyfish_formation_schedule_bounce(jellyfish_formation_ptr formation, motion_event_queue_ptr events,
+                                         int logical_width);
+
+/**
+ * Handle the formation hitting a screen edge: reverse and queue the next bounce
+ *
+ * @param formation Jellyfish formation the event was queued for
+ * @param events Motion event queue
+ * @param event_id Id of the popped event (stale events are ignored)
+ * @param logical_width Screen width for bounds checking
+ * @param tick Current simulation tick
+ */
+void jellyfish_formation_handle_bounce(jellyfish_formation_ptr formation, motion_event_queue_ptr events,
+                                       motion_event_id_t event_id, int logical_width, sim_tick_t tick);
+
+/**
+ * Update the formation (evaluate the group origin and refresh member positions)
+ *
+ * @param formation Jellyfish formation
+ * @param tick Current simulation tick
+ */
+void jellyfish_formation_update(jellyfish_formation_ptr formation, sim_tick_t tick);
 
 #endif // GAME_ENTITIES_JELLYFISH_H_
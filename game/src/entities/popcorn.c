@@ -5,43 +5,84 @@
 
 #include "popcorn.h"
 
-bool popcorn_spawn(object_pool_t *pool, float x, float y) {
+#include <stdlib.h>
+
+bool popcorn_spawn(ring_pool_t *pool, motion_event_queue_ptr events, sim_tick_t tick, sim_scalar_t x, sim_scalar_t y) {
     size_t index;
-    popcorn_ptr popcorn = (popcorn_ptr)pool_acquire(pool, &index);
+    popcorn_ptr popcorn = (popcorn_ptr)ring_pool_acquire(pool, &index);
     if (!popcorn) {
-        return false; // Pool is full
+        return false; // Ring is full
     }
 
     popcorn->active = true;
     popcorn->reflected = false;
     popcorn->x = x;
-    popcorn->y = y;
-    popcorn->vy = -POPCORN_SPEED; // Move upward
+    popcorn->motion = linear_motion(y, -SIM_FROM_FLOAT(POPCORN_SPEED), tick); // Move upward
+
+    // Leaves through the top of the screen
+    popcorn->exit_event =
+        motion_event_schedule(events, motion_tick_beyond(&popcorn->motion, 0), MOTION_EVENT_POPCORN_EXIT, popcorn);
     return true;
 }
 
-void popcorn_update_all(object_pool_t *pool, int logical_height) {
-    // Manual iteration since we need to potentially release objects
-    for (size_t i = 0; i < pool->capacity; i++) {
-        if (!pool_is_active(pool, i))
+void popcorn_update_all(ring_pool_t *pool) {
+    // Oldest to newest in each segment; stop at the first popcorn still in flight, then try the next segment
+    ring_pool_iter_t iter = ring_pool_iter(pool);
+    while (ring_pool_iter_next(&iter)) {
+        popcorn_ptr popcorn = (popcorn_ptr)iter.element;
+        if (popcorn->active) {
+            ring_pool_iter_skip_segment(&iter);
             continue;
+        }
 
-        popcorn_ptr popcorn = (popcorn_ptr)pool_get_at(pool, i);
-        if (!popcorn || !popcorn->active)
-            continue;
+        // The slot will be reused, so a pending event must not match it
+        popcorn->exit_event = MOTION_EVENT_NONE;
+        ring_pool_iter_release(&iter);
+    }
+}
+
+void popcorn_handle_exit(popcorn_ptr popcorn, motion_event_id_t event_id) {
+    if (!popcorn->active || popcorn->exit_event != event_id) {
+        return; // Spent in a collision or reflected since the event was queued
+    }
 
-        // Move popcorn (can be upward or downward if reflected)
-        popcorn->y += popcorn->vy;
+    popcorn->exit_event = MOTION_EVENT_NONE;
+    popcorn->active = false;
+}
 
-        // Deactivate if off screen (top or bottom)
-        if (popcorn->y < 0 || popcorn->y > logical_height) {
-            popcorn->active = false;
-            pool_release(pool, i);
+void popcorn_reflect(popcorn_ptr popcorn, motion_event_queue_ptr events, sim_tick_t tick, int logical_height) {
+    // Reverse direction from where it is now
+    popcorn->motion = linear_motion(popcorn_y(popcorn, tick), -popcorn->motion.velocity, tick);
+    popcorn->reflected = true;
+
+    // The old exit event goes stale; the new one is at the bottom of the screen
+    sim_scalar_t bottom = SIM_FROM_INT(logical_height);
+    popcorn->exit_event =
+        motion_event_schedule(events, motion_tick_beyond(&popcorn->motion, bottom), MOTION_EVENT_POPCORN_EXIT, popcorn);
+}
+
+bool popcorn_draw_list_init(popcorn_draw_list_ptr list, size_t capacity) {
+    list->items = malloc(capacity * sizeof(popcorn_draw_t));
+    list->count = 0;
+    list->capacity = list->items ? capacity : 0;
+    return list->items != NULL;
+}
+
+void popcorn_draw_list_build(popcorn_draw_list_ptr list, ring_pool_t *pool, sim_tick_t tick) {
+    list->count = 0;
+
+    ring_pool_iter_t iter = ring_pool_iter(pool);
+    while (ring_pool_iter_next(&iter)) {
+        popcorn_ptr popcorn = (popcorn_ptr)iter.element;
+        if (popcorn->active) {
+            popcorn_draw_list_push(list, popcorn, popcorn_y(popcorn, tick));
         }
     }
 }
 
-void popcorn_reflect(popcorn_ptr popcorn) {
-    popcorn->vy = -popcorn->vy; // Reverse direction
-    popcorn->reflected = true;
+void popcorn_draw_list_destroy(popcorn_draw_list_ptr list) {
+    free(list->items);
+    list->items = NULL;
+    list->count = 0;
+    list->capacity = 0;
 }
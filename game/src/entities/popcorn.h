@@ -1,59 +1,152 @@
 /**
  * @file popcorn.h
  * @brief Popcorn entity
+ *
+ * Popcorn flies in a straight vertical line, so its height is stored as a
+ * linear motion and evaluated on demand. The tick it leaves the screen is
+ * queued as a motion event when it is fired and again when a jellyfish
+ * reflects it.
  */
 
 #ifndef GAME_ENTITIES_POPCORN_H_
 #define GAME_ENTITIES_POPCORN_H_
 
-#include "object_pool.h"
+#include "kinematics.h"
+#include "motion_events.h"
+#include "ring_pool.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 /**
  * Popcorn entity structure
  */
 typedef struct {
-    float x;        // X position
-    float y;        // Y position
-    float vy;       // Velocity Y (vertical movement, can be negative if reflected)
-    bool active;    // True if this popcorn is in flight
-    bool reflected; // True if reflected by jellyfish
+    sim_scalar_t x;               // X position
+    linear_motion_t motion;       // Vertical motion (negative velocity is upward)
+    motion_event_id_t exit_event; // Pending off-screen event
+    bool active;                  // True if this popcorn is in flight
+    bool reflected;               // True if reflected by jellyfish
 } popcorn_t;
 
 // Pointer typedef for popcorn
 typedef popcorn_t *popcorn_ptr;
 
+/**
+ * Popcorn draw command (screen position of one sprite)
+ */
+typedef struct {
+    int x;
+    int y;
+} popcorn_draw_t;
+
+/**
+ * Popcorn sprites to draw this frame, in ring order
+ */
+typedef struct {
+    popcorn_draw_t *items; // Draw commands
+    size_t count;          // Commands queued this frame
+    size_t capacity;       // One per popcorn ring slot
+} popcorn_draw_list_t;
+
+// Pointer typedef for popcorn draw list
+typedef popcorn_draw_list_t *popcorn_draw_list_ptr;
+
 // Popcorn sprite dimensions
 #define POPCORN_WIDTH 7    // Sprite width
 #define POPCORN_HEIGHT 6   // Sprite height
 #define POPCORN_SPEED 6.0f // Upward speed
 
-// Pool size
-#define MAX_POPCORN 10 // Maximum number of popcorn on screen
+// Ring pool size (popcorn die roughly in the order they were fired; segments chain as they fill)
+#define POPCORN_RING_SEGMENT 32  // Popcorn slots per ring segment
+#define MAX_POPCORN_CAPACITY 160 // Upper bound on popcorn in flight
+
+/**
+ * Y position of a popcorn at a simulation tick
+ *
+ * @param popcorn Popcorn
+ * @param tick Simulation tick
+ * @return Y position
+ */
+static inline sim_scalar_t popcorn_y(const popcorn_t *popcorn, sim_tick_t tick) {
+    return motion_position(&popcorn->motion, tick);
+}
 
 /**
- * Spawn a popcorn using object pool
+ * Spawn a popcorn at the tail of the popcorn ring and queue its exit
  *
- * @param pool Object pool for popcorn
+ * @param pool Ring pool for popcorn
+ * @param events Motion event queue
+ * @param tick Current simulation tick
  * @param x Starting X position
  * @param y Starting Y position
- * @return true if spawned successfully, false if pool is full
+ * @return true if spawned successfully, false if the ring is full
  */
-bool popcorn_spawn(object_pool_t *pool, float x, float y);
+bool popcorn_spawn(ring_pool_t *pool, motion_event_queue_ptr events, sim_tick_t tick, sim_scalar_t x, sim_scalar_t y);
 
 /**
- * Update all active popcorn using object pool
+ * Release spent popcorn from the head of the ring
  *
- * @param pool Object pool for popcorn
- * @param logical_height Screen height for bounds checking
+ * Popcorn spent out of order stays in the ring, inactive, until every
+ * older popcorn is gone.
+ *
+ * @param pool Ring pool for popcorn
  */
-void popcorn_update_all(object_pool_t *pool, int logical_height);
+void popcorn_update_all(ring_pool_t *pool);
 
 /**
- * Reflect a popcorn downward
+ * Handle a popcorn leaving the screen
+ *
+ * @param popcorn Popcorn the event was queued for
+ * @param event_id Id of the popped event (stale events are ignored)
+ */
+void popcorn_handle_exit(popcorn_ptr popcorn, motion_event_id_t event_id);
+
+/**
+ * Reflect a popcorn downward and queue its new exit
  *
  * @param popcorn Popcorn to reflect
+ * @param events Motion event queue
+ * @param tick Current simulation tick
+ * @param logical_height Screen height the popcorn leaves through
+ */
+void popcorn_reflect(popcorn_ptr popcorn, motion_event_queue_ptr events, sim_tick_t tick, int logical_height);
+
+/**
+ * Allocate a popcorn draw list
+ *
+ * @param list Draw list to initialize
+ * @param capacity Maximum commands per frame (the popcorn ring capacity)
+ * @return true if successful
+ */
+bool popcorn_draw_list_init(popcorn_draw_list_ptr list, size_t capacity);
+
+/**
+ * Queue a draw for every popcorn in flight (a full pass over the ring)
+ *
+ * @param list Draw list, cleared first
+ * @param pool Ring pool for popcorn
+ * @param tick Simulation tick positions are evaluated at
+ */
+void popcorn_draw_list_build(popcorn_draw_list_ptr list, ring_pool_t *pool, sim_tick_t tick);
+
+/**
+ * Free the memory owned by a popcorn draw list
+ *
+ * @param list Draw list
+ */
+void popcorn_draw_list_destroy(popcorn_draw_list_ptr list);
+
+/**
+ * Queue one popcorn draw
+ *
+ * @param list Draw list (sized for the whole ring, so it never overflows)
+ * @param popcorn Popcorn to draw
+ * @param y Popcorn Y position at the tick being drawn
  */
-void popcorn_reflect(popcorn_ptr popcorn);
+static inline void popcorn_draw_list_push(popcorn_draw_list_ptr list, const popcorn_t *popcorn, sim_scalar_t y) {
+    popcorn_draw_t *draw = &list->items[list->count++];
+    draw->x = SIM_TO_INT(popcorn->x);
+    draw->y = SIM_TO_INT(y);
+}
 
 #endif // GAME_ENTITIES_POPCORN_H_
@@ -4,60 +4,132 @@
  */
 
 #include "entity_factory.h"
-#include "clock.h"
 #include "constants.h"
-#include "object_pool.h"
+#include "entity_pool.h"
 
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 
-void create_duck(duck_ptr duck, float x, float y) { duck_init(duck, x, y); }
-
-bool create_crab(crab_ptr crab) {
-    if (!crab) {
-        return false;
-    }
-
-    // Random position in top 60% of screen
-    const int top_60_percent = (int)(LOGICAL_HEIGHT * 0.6f);
-    const int crab_width = CRAB_WIDTH;
-    const int crab_height = CRAB_HEIGHT;
-
-    // Random x position within screen bounds
-    crab->x = (float)(rand() % (LOGICAL_WIDTH - crab_width));
+// Crabs initialized per inner pass of spawn_crabs_from_prototype
+#define CRAB_SPAWN_BATCH 64
+
+// Stateless 32-bit integer hash (lowbias32); independent per lane so batches vectorize
+static inline uint32_t hash_u32(uint32_t value) {
+    value ^= value >> 16;
+    value *= 0x7feb352dU;
+    value ^= value >> 15;
+    value *= 0x846ca68bU;
+    value ^= value >> 16;
+    return value;
+}
 
-    // Random y position in top 60% of screen
-    crab->y = (float)(rand() % (top_60_percent - crab_height));
+// Map a 32-bit random value onto [0, range) without a division
+static inline uint32_t random_below(uint32_t random, uint32_t range) {
+    return (uint32_t)(((uint64_t)random * range) >> 32);
+}
 
-    // Random velocity between min and max speed
-    float speed = CRAB_MIN_SPEED + ((float)rand() / RAND_MAX) * CRAB_SPEED_RANGE;
+void create_duck(duck_ptr duck, sim_scalar_t x, sim_scalar_t y) { duck_init(duck, x, y); }
+
+crab_t make_crab_prototype(void) {
+    crab_t prototype;
+    prototype.motion = linear_motion(0, 0, 0);
+    prototype.y = 0;
+    prototype.moving_right = true;
+    prototype.alive = true;
+    prototype.has_brick = false;
+    prototype.wrap_event = MOTION_EVENT_NONE;
+    prototype.dropping = false;
+    prototype.drop_ready = false;
+    prototype.drop_timer = TIMER_HANDLE_INVALID;
+    prototype.animation = SPRITE_ANIMATION_NONE;
+    return prototype;
+}
 
-    // Random initial direction
-    crab->moving_right = (rand() % 2) == 0;
-    crab->vx = crab->moving_right ? speed : -speed;
-    crab->alive = true;
-    crab->has_brick = false;
-    crab->off_screen = false;
-    crab->dropping = false;
-    crab->drop_start_time = 0;
+size_t spawn_crabs_from_prototype(entity_pool_t *pool, timer_wheel_ptr timers, sprite_animation_system_ptr animations,
+                                  motion_event_queue_ptr events, const crab_t *prototype, size_t count,
+                                  sim_tick_t tick, timestamp_ms_t current_time, bool enter_from_edge) {
+    if (!pool || !prototype) {
+        return 0;
+    }
 
-    // Random time between 3-8 seconds before first drop
-    crab->next_drop_time = get_clock_ticks_ms() + 3000 + (rand() % 5000);
+    // Crabs spawn anywhere across LOGICAL_WIDTH and within the top CRAB_ZONE_HEIGHT rows, walking at
+    // CRAB_MIN_SPEED plus up to CRAB_SPEED_RANGE
+    const uint32_t x_range = LOGICAL_WIDTH - CRAB_WIDTH;
+    const uint32_t y_range = (uint32_t)CRAB_ZONE_HEIGHT - CRAB_HEIGHT;
+
+    // One rand() call seeds the whole wave, so srand() still controls the sequence
+    const uint32_t seed = (uint32_t)rand() * 0x9E3779B9U;
+
+    size_t indices[CRAB_SPAWN_BATCH];
+    sim_scalar_t xs[CRAB_SPAWN_BATCH];
+    sim_scalar_t ys[CRAB_SPAWN_BATCH];
+    sim_scalar_t vxs[CRAB_SPAWN_BATCH];
+    uint32_t drop_delays[CRAB_SPAWN_BATCH];
+
+    size_t spawned = 0;
+    while (spawned < count) {
+        size_t batch = count - spawned;
+        if (batch > CRAB_SPAWN_BATCH) {
+            batch = CRAB_SPAWN_BATCH;
+        }
+
+        size_t acquired = entity_pool_acquire_n(pool, batch, indices);
+
+        // Random fields for the whole batch, one independent hash stream per field
+        for (size_t i = 0; i < acquired; i++) {
+            uint32_t lane = seed + (uint32_t)(spawned + i) * 4U;
+            uint32_t speed_bits = hash_u32(lane + 2U);
+            sim_scalar_t speed =
+                SIM_FROM_FLOAT(CRAB_MIN_SPEED) + sim_random_below(speed_bits, SIM_FROM_FLOAT(CRAB_SPEED_RANGE));
+
+            xs[i] = SIM_FROM_INT(random_below(hash_u32(lane), x_range));
+            ys[i] = SIM_FROM_INT(random_below(hash_u32(lane + 1U), y_range));
+            vxs[i] = (speed_bits & 1U) ? speed : -speed;
+            drop_delays[i] = CRAB_DROP_DELAY_MIN_MS + random_below(hash_u32(lane + 3U), CRAB_DROP_DELAY_RANGE_MS);
+        }
+
+        for (size_t i = 0; i < acquired; i++) {
+            crab_ptr crab = (crab_ptr)entity_pool_slot(pool, indices[i]);
+            *crab = *prototype;
+            crab->y = ys[i];
+            crab->moving_right = vxs[i] > 0;
+
+            sim_scalar_t x = xs[i];
+            if (enter_from_edge) {
+                x = crab->moving_right ? SIM_FROM_INT(-CRAB_WIDTH) : SIM_FROM_INT(LOGICAL_WIDTH);
+            }
+            crab->motion = linear_motion(x, vxs[i], tick);
+            crab_schedule_wrap(crab, events, LOGICAL_WIDTH);
+
+            crab_schedule_drop(crab, timers, current_time + drop_delays[i]);
+            crab->animation = sprite_animation_create(animations, ANIMATION_CLIP_CRAB_WALK, 0, current_time);
+        }
+
+        spawned += acquired;
+        if (acquired < batch) {
+            break; // Pool is at its maximum capacity
+        }
+    }
 
-    return true;
+    return spawned;
 }
 
-void create_jellyfish(jellyfish_ptr jellyfish, float x, float y, float group_velocity_x, bool moving_right,
-                      int anim_offset) {
-    if (!jellyfish) {
+void create_jellyfish_formation(jellyfish_formation_ptr formation, sim_scalar_t x, sim_scalar_t y,
+                                sim_scalar_t group_velocity_x, bool moving_right, int member_count,
+                                sim_scalar_t spacing, sim_tick_t tick) {
+    if (!formation) {
         return;
     }
 
-    jellyfish->x = x;
-    jellyfish->y = y;
-    jellyfish->moving_right = moving_right;
-    jellyfish->vx = group_velocity_x;
-    jellyfish->anim_frame = anim_offset % 4;
-    jellyfish->last_anim_time = get_clock_ticks_ms();
+    jellyfish_formation_init(formation, x, y, group_velocity_x, moving_right, tick);
+
+    // Members sit side by side; each starts on a different animation frame
+    for (int i = 0; i < member_count; i++) {
+        if (!jellyfish_formation_add_member(formation, i * (SIM_FROM_INT(JELLYFISH_WIDTH) + spacing), 0, i)) {
+            break; // Formation is full
+        }
+    }
 }
 
 void create_entity_pools(game_ptr game) {
@@ -65,10 +137,21 @@ void create_entity_pools(game_ptr game) {
         return;
     }
 
-    game->popcorn_pool = create_object_pool(sizeof(popcorn_t), MAX_POPCORN);
-    game->crab_pool = create_object_pool(sizeof(crab_t), NUM_CRABS);
-    game->brick_pool = create_object_pool(sizeof(brick_t), MAX_BRICKS);
-    game->jellyfish_pool = create_object_pool(sizeof(jellyfish_t), NUM_JELLYFISH);
+    // Shots and bricks mostly die in creation order, so they live in rings that grow a segment at a time
+    game->popcorn_pool = create_ring_pool(sizeof(popcorn_t), POPCORN_RING_SEGMENT, MAX_POPCORN_CAPACITY);
+    game->crab_pool = create_growable_entity_pool(sizeof(crab_t), NUM_CRABS, MAX_CRABS_CAPACITY);
+    game->brick_pool = create_ring_pool(sizeof(brick_t), BRICK_RING_SEGMENT, MAX_BRICKS_CAPACITY);
+}
+
+void report_entity_pool_usage(game_ptr game) {
+    if (!game || game->crab_pool.capacity == 0) {
+        return; // Pools were never created
+    }
+
+    printf("Entity pool usage:\n");
+    ring_pool_print_stats(&game->popcorn_pool, "popcorn");
+    entity_pool_print_stats(&game->crab_pool, "crab");
+    ring_pool_print_stats(&game->brick_pool, "brick");
 }
 
 void destroy_entity_pools(game_ptr game) {
@@ -76,8 +159,7 @@ void destroy_entity_pools(game_ptr game) {
         return;
     }
 
-    pool_destroy(&game->popcorn_pool);
-    pool_destroy(&game->crab_pool);
-    pool_destroy(&game->brick_pool);
-    pool_destroy(&game->jellyfish_pool);
+    ring_pool_destroy(&game->popcorn_pool);
+    entity_pool_destroy(&game->crab_pool);
+    ring_pool_destroy(&game->brick_pool);
 }
@@ -23,26 +23,50 @@
  * @param x Initial X position
  * @param y Initial Y position
  */
-void create_duck(duck_ptr duck, float x, float y);
+void create_duck(duck_ptr duck, sim_scalar_t x, sim_scalar_t y);
 
 /**
- * @brief Create and initialize a crab entity with random properties
- * @param crab Crab entity to initialize
- * @return true if creation successful, false otherwise
+ * @brief Build the template every spawned crab starts from
+ * @return Crab with all non-random fields set (alive, no brick, not dropping)
  */
-bool create_crab(crab_ptr crab);
+crab_t make_crab_prototype(void);
 
 /**
- * @brief Create and initialize a jellyfish entity
- * @param jellyfish Jellyfish entity to initialize
- * @param x Initial X position
- * @param y Initial Y position
+ * @brief Spawn a wave of crabs from a prototype in one pass
+ *
+ * Slots are acquired in bulk and the random position, speed, direction and
+ * first drop time of the whole batch are generated together before being
+ * written over copies of the prototype.
+ *
+ * @param pool Object pool for crabs
+ * @param timers Timer wheel the first drop timer of every crab is armed on
+ * @param animations Animation system every new crab gets its walk animation from
+ * @param events Motion event queue the first wrap of every crab is queued on
+ * @param prototype Template copied into every new crab
+ * @param count Number of crabs to spawn
+ * @param tick Current simulation tick (the crabs start walking from here)
+ * @param current_time Current game time (used for the first drop time)
+ * @param enter_from_edge true to start each crab just off the edge it walks in from
+ * @return Number of crabs actually spawned
+ */
+size_t spawn_crabs_from_prototype(entity_pool_t *pool, timer_wheel_ptr timers, sprite_animation_system_ptr animations,
+                                  motion_event_queue_ptr events, const crab_t *prototype, size_t count,
+                                  sim_tick_t tick, timestamp_ms_t current_time, bool enter_from_edge);
+
+/**
+ * @brief Create and initialize a jellyfish formation laid out in a row
+ * @param formation Jellyfish formation to initialize
+ * @param x Initial X position of the formation
+ * @param y Initial Y position of the formation
  * @param group_velocity_x Velocity for group movement
  * @param moving_right Direction of movement
- * @param anim_offset Animation frame offset
+ * @param member_count Number of jellyfish in the row
+ * @param spacing Horizontal gap between neighbouring jellyfish
+ * @param tick Simulation tick the formation starts moving at (its first bounce is armed by the caller)
  */
-void create_jellyfish(jellyfish_ptr jellyfish, float x, float y, float group_velocity_x, bool moving_right,
-                      int anim_offset);
+void create_jellyfish_formation(jellyfish_formation_ptr formation, sim_scalar_t x, sim_scalar_t y,
+                                sim_scalar_t group_velocity_x, bool moving_right, int member_count,
+                                sim_scalar_t spacing, sim_tick_t tick);
 
 /**
  * @brief Create and initialize object pools for all entity types
@@ -50,6 +74,12 @@ void create_jellyfish(jellyfish_ptr jellyfish, float x, float y, float group_vel
  */
 void create_entity_pools(game_ptr game);
 
+/**
+ * @brief Print occupancy telemetry (peak, failures, growth) for every entity pool
+ * @param game Game state containing pools to report on
+ */
+void report_entity_pool_usage(game_ptr game);
+
 /**
  * @brief Destroy all entity object pools
  * @param game Game state containing pools to destroy
@@ -4,24 +4,36 @@
  */
 
 #include "entity_initializer.h"
-#include "clock.h"
 #include "constants.h"
 #include "entity_factory.h"
-#include "object_pool.h"
+#include "entity_pool.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 
 // Forward declarations for helper functions
+static void initialize_duck(game_ptr game);
 static void initialize_crabs(game_ptr game);
 static void initialize_jellyfish(game_ptr game);
 
 void initialize_all_entities(game_ptr game) {
-    // Initialize duck in the center, right on top of the lake
-    const int duck_height = DUCK_HEIGHT;
-    create_duck(&game->duck, LOGICAL_WIDTH / 2.0f, LAKE_START_Y - duck_height);
-
     // Create object pools using factory
     create_entity_pools(game);
+    popcorn_draw_list_init(&game->popcorn_draws, game->popcorn_pool.max_capacity);
+
+    // Timer wheel for entity deadlines: one timer per crab and brick at most, plus duck and jellyfish
+    timer_wheel_init(&game->timers, game->crab_pool.max_capacity + game->brick_pool.max_capacity + GAME_TIMER_SLACK,
+                     game->sim_time);
+
+    // Predicted wraps, bounces, landings and exits of the analytic movers
+    game->sim_tick = 0;
+    motion_event_queue_init(&game->motion_events, GAME_MOTION_EVENT_CAPACITY);
+
+    // One animation per crab, jellyfish and the duck
+    sprite_animation_system_init(&game->animations, game->crab_pool.max_capacity + NUM_JELLYFISH + 1);
+
+    // Initialize duck in the center, right on top of the lake
+    initialize_duck(game);
 
     // Initialize crabs using factory
     initialize_crabs(game);
@@ -30,19 +42,43 @@ void initialize_all_entities(game_ptr game) {
     initialize_jellyfish(game);
 }
 
+void reset_all_entities(game_ptr game) {
+    // Pending timers, motion events and animations point into the slots about to be reset
+    timer_wheel_clear(&game->timers, game->sim_time);
+    motion_event_queue_clear(&game->motion_events);
+    game->sim_tick = 0;
+    sprite_animation_system_reset(&game->animations);
+
+    // Bulk-reset every pool in O(1), keeping chunks grown during the last game
+    ring_pool_reset(&game->popcorn_pool);
+    entity_pool_reset(&game->crab_pool);
+    ring_pool_reset(&game->brick_pool);
+    game->popcorn_draws.count = 0;
+
+    // Spawn a fresh layout exactly like a cold start
+    initialize_duck(game);
+    initialize_crabs(game);
+    initialize_jellyfish(game);
+}
+
+static void initialize_duck(game_ptr game) {
+    const int duck_height = DUCK_HEIGHT;
+    create_duck(&game->duck, SIM_FROM_INT(LOGICAL_WIDTH) / 2, SIM_FROM_INT(LAKE_START_Y - duck_height));
+    game->duck.animation =
+        sprite_animation_create(&game->animations, ANIMATION_CLIP_DUCK_IDLE, 0, game->sim_time);
+}
+
 static void initialize_crabs(game_ptr game) {
-    for (int i = 0; i < NUM_CRABS; i++) {
-        size_t crab_index;
-        crab_ptr crab = (crab_ptr)pool_acquire(&game->crab_pool, &crab_index);
-        if (!crab) {
-            break; // Pool is full
-        }
-
-        // Use factory to create crab with random properties
-        if (!create_crab(crab)) {
-            pool_release(&game->crab_pool, crab_index);
-        }
-    }
+    timestamp_ms_t current_time = game->sim_time;
+
+    // Spawn the whole wave in one batched pass from the crab template
+    crab_t prototype = make_crab_prototype();
+    spawn_crabs_from_prototype(&game->crab_pool, &game->timers, &game->animations, &game->motion_events, &prototype,
+                               NUM_CRABS, game->sim_tick, current_time, false);
+    game->crabs_with_bricks = 0; // Prototype crabs start without a brick
+
+    // Destroyed crabs are replaced by scheduled respawn waves
+    wave_manager_init(&game->crab_waves, NUM_CRABS, current_time);
 }
 
 static void initialize_jellyfish(game_ptr game) {
@@ -50,32 +86,31 @@ static void initialize_jellyfish(game_ptr game) {
     int jellyfish_zone_y = (int)(LOGICAL_HEIGHT * 0.7f);
     const int jellyfish_spacing = 1;
 
-    // Random group movement parameters (all jellyfish move together)
-    float speed = JELLYFISH_MIN_SPEED + ((float)rand() / RAND_MAX) * JELLYFISH_SPEED_RANGE;
+    // Random group movement parameters (all jellyfish move together); the speed is drawn in integer
+    // math, like crab speeds, so the fixed-point build gets the same value whatever the float flags
+    uint32_t speed_bits = (uint32_t)rand() * 0x9E3779B9U;
+    sim_scalar_t speed =
+        SIM_FROM_FLOAT(JELLYFISH_MIN_SPEED) + sim_random_below(speed_bits, SIM_FROM_FLOAT(JELLYFISH_SPEED_RANGE));
     bool moving_right = (rand() % 2) == 0;
-    float group_velocity_x = moving_right ? speed : -speed;
+    sim_scalar_t group_velocity_x = moving_right ? speed : -speed;
 
     // Calculate starting position to center all jellyfish as a group
-    float total_width = (JELLYFISH_WIDTH * NUM_JELLYFISH) + (jellyfish_spacing * (NUM_JELLYFISH - 1));
-    float start_x = (LOGICAL_WIDTH - total_width) / 2.0f;
-
-    for (int i = 0; i < NUM_JELLYFISH; i++) {
-        size_t jellyfish_index;
-        jellyfish_ptr jellyfish = (jellyfish_ptr)pool_acquire(&game->jellyfish_pool, &jellyfish_index);
-        if (!jellyfish) {
-            break; // Pool is full
-        }
-
-        // Calculate position for this jellyfish
-        float x = start_x + (i * (JELLYFISH_WIDTH + jellyfish_spacing));
-        float y = jellyfish_zone_y;
-
-        // Use factory to create jellyfish
-        create_jellyfish(jellyfish, x, y, group_velocity_x, moving_right, i);
-    }
+    int total_width = (JELLYFISH_WIDTH * NUM_JELLYFISH) + (jellyfish_spacing * (NUM_JELLYFISH - 1));
+    sim_scalar_t start_x = SIM_FROM_INT(LOGICAL_WIDTH - total_width) / 2;
+
+    // Use factory to create the formation
+    create_jellyfish_formation(&game->jellyfish_formation, start_x, SIM_FROM_INT(jellyfish_zone_y), group_velocity_x,
+                               moving_right, NUM_JELLYFISH, SIM_FROM_INT(jellyfish_spacing), game->sim_tick);
+    jellyfish_formation_schedule_bounce(&game->jellyfish_formation, &game->motion_events, LOGICAL_WIDTH);
+    jellyfish_formation_start_animation(&game->jellyfish_formation, &game->animations, game->sim_time);
 }
 
 void cleanup_all_entities(game_ptr game) {
     // Use factory to destroy pools
     destroy_entity_pools(game);
+    popcorn_draw_list_destroy(&game->popcorn_draws);
+
+    timer_wheel_destroy(&game->timers);
+    motion_event_queue_destroy(&game->motion_events);
+    sprite_animation_system_destroy(&game->animations);
 }
@@ -18,6 +18,12 @@
  */
 void initialize_all_entities(game_ptr game);
 
+/**
+ * @brief Reset all entities for a new game without reallocating pools
+ * @param game Game state containing entities to reset
+ */
+void reset_all_entities(game_ptr game);
+
 /**
  * @brief Clean up all entity resources
  * @param game Game state containing entities to clean up
@@ -21,9 +21,27 @@
 #define FPS 60
 #define FRAME_DELAY (1000 / FPS)
 
+// Prompts stay on, then off, for this long (the screen is otherwise still while they blink)
+#define PROMPT_BLINK_MS 500
+
+// Game rules
+#define INITIAL_LIVES 3
+
+// Timer wheel capacity beyond one timer per crab and brick (duck, jellyfish animation)
+#define GAME_TIMER_SLACK 16
+
+// Initial motion event queue capacity (the heap grows if stale events pile up)
+#define GAME_MOTION_EVENT_CAPACITY 256
+
+// Sprites queued per texture before the sprite batch has to submit early
+#define SPRITE_BATCH_CAPACITY 4096
+
 // Side rectangle dimensions
 #define SIDE_RECT_WIDTH ((int)(LOGICAL_WIDTH * 0.055)) // 0.055 * 710 = 39 pixels
 
+// Crabs walk inside the top 60% of the screen
+#define CRAB_ZONE_HEIGHT ((int)(LOGICAL_HEIGHT * 0.6f))
+
 // Lake calculations
 #define LAKE_HEIGHT (LOGICAL_HEIGHT / 10)
 #define LAKE_START_Y (LOGICAL_HEIGHT - LAKE_HEIGHT)
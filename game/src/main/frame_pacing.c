@@ -0,0 +1,59 @@
+/**
+ * @file frame_pacing.c
+ * @brief Frame skipping and idle sleeping implementation
+ */
+
+#include "frame_pacing.h"
+
+#include "clock.h"
+
+void frame_pacing_begin(frame_pacing_ptr pacing) {
+    pacing->idle = false;
+    pacing->wake_time = 0;
+}
+
+void frame_pacing_idle_until(frame_pacing_ptr pacing, timestamp_ms_t wake_time) {
+    pacing->idle = true;
+    pacing->wake_time = wake_time;
+}
+
+bool frame_pacing_check_suspended(frame_pacing_ptr pacing, const graphics_context_t *graphics_context) {
+    uint32_t flags = SDL_GetWindowFlags(graphics_context->window);
+    bool suspended = (flags & (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN)) || !(flags & SDL_WINDOW_INPUT_FOCUS);
+
+    // Whatever was on screen may be gone once the window comes back
+    if (pacing->suspended && !suspended) {
+        pacing->redraw = true;
+    }
+    pacing->suspended = suspended;
+
+    if (suspended) {
+        pacing->idle = true;
+        pacing->wake_time = get_clock_ticks_ms() + FRAME_PACING_MAX_IDLE_MS;
+    }
+    return suspended;
+}
+
+void frame_pacing_wait(frame_pacing_ptr pacing, frame_limiter_t *frame_limiter) {
+    if (!pacing->idle) {
+        pacing->presented_frames++;
+        pacing->redraw = false;
+        frame_limiter_wait(frame_limiter);
+        return;
+    }
+
+    if (!pacing->suspended) {
+        pacing->skipped_frames++;
+    }
+
+    timestamp_ms_t now = get_clock_ticks_ms();
+    timestamp_ms_t timeout = pacing->wake_time > now ? pacing->wake_time - now : 0;
+    if (timeout > FRAME_PACING_MAX_IDLE_MS) {
+        timeout = FRAME_PACING_MAX_IDLE_MS;
+    }
+
+    // Returns as soon as any event is queued, without taking it off the queue
+    if (timeout > 0) {
+        SDL_WaitEventTimeout(NULL, (int)timeout);
+    }
+}
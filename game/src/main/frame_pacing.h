@@ -0,0 +1,92 @@
+/**
+ * @file frame_pacing.h
+ * @brief Frame skipping and idle sleeping for the main loop
+ *
+ * Every update starts active. A stage whose screen would come out identical
+ * (a title waiting for a key, a settled game over) skips drawing and tells
+ * the pacer when it next changes, usually the next blink of a prompt; the
+ * loop then sleeps until that deadline or until an input event arrives
+ * instead of presenting the same frame again. While the window is
+ * minimized, hidden or in the background the loop stops updating stages
+ * altogether and only wakes for events.
+ */
+
+#ifndef GAME_SRC_MAIN_FRAME_PACING_H_
+#define GAME_SRC_MAIN_FRAME_PACING_H_
+
+#include "frame_limiter.h"
+#include "graphics.h"
+#include "types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Longest single sleep, so a missed wake-up never stalls the loop for long
+#define FRAME_PACING_MAX_IDLE_MS 250
+
+/**
+ * Frame pacing state shared by the main loop and the stages
+ */
+typedef struct {
+    bool idle;                 // The current update drew nothing; sleep until wake_time or input
+    timestamp_ms_t wake_time;  // When the idle screen next changes
+    bool suspended;            // The window was minimized, hidden or unfocused on the last check
+    bool redraw;               // Stages must draw even an unchanged screen (set after a suspension)
+    uint64_t presented_frames; // Updates that drew a frame
+    uint64_t skipped_frames;   // Updates that found nothing new to draw
+} frame_pacing_t;
+
+// Pointer typedef for frame pacing
+typedef frame_pacing_t *frame_pacing_ptr;
+
+/**
+ * @brief Start an update (active until a stage reports otherwise)
+ * @param pacing Frame pacing state
+ */
+void frame_pacing_begin(frame_pacing_ptr pacing);
+
+/**
+ * @brief Report that the screen is unchanged until a deadline (or until input)
+ * @param pacing Frame pacing state
+ * @param wake_time Next time the screen changes on its own
+ */
+void frame_pacing_idle_until(frame_pacing_ptr pacing, timestamp_ms_t wake_time);
+
+/**
+ * @brief Check whether a stage has to draw a frame
+ * @param pacing Frame pacing state
+ * @param changed Whether the stage's screen changed since it last drew
+ * @return true if the frame must be drawn (changed, or a redraw was requested)
+ */
+static inline bool frame_pacing_should_draw(const frame_pacing_t *pacing, bool changed) {
+    return changed || pacing->redraw;
+}
+
+/**
+ * @brief Next time a blinking element toggles
+ * @param start_time When the blinking started
+ * @param current_time Current time
+ * @param half_period_ms Time the element stays in each state
+ * @return Time of the next toggle
+ */
+static inline timestamp_ms_t frame_pacing_next_toggle(timestamp_ms_t start_time, timestamp_ms_t current_time,
+                                                      uint32_t half_period_ms) {
+    timestamp_ms_t elapsed = current_time > start_time ? current_time - start_time : 0;
+    return start_time + (elapsed / half_period_ms + 1) * half_period_ms;
+}
+
+/**
+ * @brief Check whether the window is out of sight or out of focus
+ * @param pacing Frame pacing state (a window coming back requests a redraw)
+ * @param graphics_context Graphics context owning the window
+ * @return true if stages should not be updated
+ */
+bool frame_pacing_check_suspended(frame_pacing_ptr pacing, const graphics_context_t *graphics_context);
+
+/**
+ * @brief Wait for the next update: a frame-rate wait if active, a sleep until the deadline or input if idle
+ * @param pacing Frame pacing state
+ * @param frame_limiter Frame limiter used while active
+ */
+void frame_pacing_wait(frame_pacing_ptr pacing, frame_limiter_t *frame_limiter);
+
+#endif // GAME_SRC_MAIN_FRAME_PACING_H_
@@ -12,8 +12,10 @@
 #include "clock.h"
 #include "collision_system.h"
 #include "constants.h"
+#include "entity_factory.h"
 #include "entity_initializer.h"
 #include "keyboard.h"
+#include "particle_effects.h"
 #include "resource_manager.h"
 #include "score.h"
 
@@ -41,7 +43,9 @@ bool game_init(game_t *game) {
     game->tribute_waiting = true; // Wait for space key before scrolling
 
     // Initialize all game entities
+    game->sim_time = get_clock_ticks_ms();
     initialize_all_entities(game);
+    game->fused_popcorn_pass = true;
 
     // Initialize simple collision system
     if (!collision_system_init(game)) {
@@ -51,19 +55,55 @@ bool game_init(game_t *game) {
     // Subscribe to game events for scoring
     subscribe_score_events(game);
 
+    // Particle bursts for crab hits and duck deaths
+    if (!particle_system_init(&game->particles, PARTICLE_CAPACITY, PARTICLE_GRAVITY, LOGICAL_HEIGHT, PARTICLE_SIZE,
+                              (uint32_t)time(NULL))) {
+        return false;
+    }
+    subscribe_particle_events(game);
+
+    // Vertex buffers for batched sprite drawing
+    if (!sprite_batch_init(&game->sprite_batch, SPRITE_BATCH_CAPACITY)) {
+        return false;
+    }
+
+    // Room for every entity the pools can hold, plus the jellyfish and the duck
+    size_t sprite_capacity = game->crab_pool.max_capacity + game->popcorn_pool.max_capacity +
+                             game->brick_pool.max_capacity + NUM_JELLYFISH + 1;
+    if (!render_snapshot_buffer_init(&game->snapshots, sprite_capacity, &game->particles)) {
+        return false;
+    }
+
     // Initialize game statistics
-    game->lives = 3;
+    game->lives = INITIAL_LIVES;
     game->score = 0;
 
     return true;
 }
 
+void game_restart(game_t *game) {
+    // Entities and pools are reset in place; every loaded resource is kept
+    reset_all_entities(game);
+    particle_system_clear(&game->particles);
+
+    game->lives = INITIAL_LIVES;
+    game->score = 0;
+    game->current_screen = SCREEN_GAME;
+}
+
 void game_terminate(game_t *game) {
+    // Report pool occupancy so capacities can be tuned from real sessions
+    report_entity_pool_usage(game);
+    printf("Particles  peak %5zu / capacity %5zu\n", game->particles.peak_count, game->particles.capacity);
+
     // Clean up collision system
     collision_system_cleanup();
 
     // Clean up entity pools
     cleanup_all_entities(game);
+    particle_system_destroy(&game->particles);
+    sprite_batch_destroy(&game->sprite_batch);
+    render_snapshot_buffer_destroy(&game->snapshots);
 
     // Free all game resources
     free_game_resources(game);
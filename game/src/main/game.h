@@ -15,9 +15,11 @@
 #include "audio.h"
 #include "bitmap_font.h"
 #include "event_system.h"
+#include "frame_pacing.h"
 #include "graphics.h"
 #include "keyboard.h"
-#include "object_pool.h"
+#include "entity_pool.h"
+#include "ring_pool.h"
 #include "texture.h"
 
 // Entity modules
@@ -27,6 +29,28 @@
 #include "jellyfish.h"
 #include "popcorn.h"
 
+// Crab respawn schedule
+#include "wave_manager.h"
+
+// Entity deadlines, motion events and animation
+#include "motion_events.h"
+#include "sprite_animation.h"
+#include "timer_wheel.h"
+
+// Cosmetic hit and death effects
+#include "particle_system.h"
+
+// Session recording and playback
+#include "replay.h"
+
+// Batched sprite drawing and pre-baked layers
+#include "lake_layer.h"
+#include "render_layer.h"
+#include "render_snapshot.h"
+#include "software_renderer.h"
+#include "sprite_batch.h"
+#include "text_cache.h"
+
 // Forward declarations for stage system
 typedef struct stage_t stage_t;
 
@@ -60,10 +84,22 @@ typedef struct {
     audio_context_t audio_context;
     event_system_t event_system;
     keyboard_state_t keyboard_state;
+    frame_pacing_t pacing; // Frame skipping and idle sleeping for static screens
 
     // Resources
     texture_t sprite_sheet;
     texture_t cover_image;
+    lake_layer_t lake; // Lake gradient baked at load time
+
+    // Cached layers composited every frame and redrawn only when dirty
+    render_layer_t background_layer;   // Clear color and lake
+    render_layer_t hud_layer;          // Lives and score
+    int hud_lives;                     // Lives the HUD layer was last drawn with
+    int hud_score;                     // Score the HUD layer was last drawn with
+    cached_text_t score_text;          // Score string, redrawn only when the score changes
+    SDL_atomic_t render_target_resets; // Render-target resets, counted by an SDL event watch
+    int drawn_target_resets;           // Resets the layers and score text were last drawn after
+
     int cover_width;
     int cover_height;
     bitmap_font_t font;
@@ -84,11 +120,53 @@ typedef struct {
     // Game entities
     duck_t duck;
 
-    // Object pools for efficient entity management
-    object_pool_t popcorn_pool;
-    object_pool_t crab_pool;
-    object_pool_t brick_pool;
-    object_pool_t jellyfish_pool;
+    // Cache-line aligned pools for efficient entity management
+    // (popcorn and bricks die roughly in creation order, so they live in rings)
+    ring_pool_t popcorn_pool;
+    entity_pool_t crab_pool;
+    ring_pool_t brick_pool;
+
+    // Popcorn sprites queued for this frame; with fused_popcorn_pass the collision
+    // pass retires, collides and queues each popcorn in one visit
+    popcorn_draw_list_t popcorn_draws;
+    bool fused_popcorn_pass;
+
+    // Jellyfish move as a single formation
+    jellyfish_formation_t jellyfish_formation;
+
+    // Time-triggered entity logic (drops, brick timeouts, animation, respawn)
+    timer_wheel_t timers;
+
+    // Analytic movers are evaluated at the current simulation tick; their
+    // wraps, bounces, landings and exits are queued as motion events
+    sim_tick_t sim_tick;
+    motion_event_queue_t motion_events;
+
+    // Clock for the current tick, sampled once per update (or read from the replay); gameplay
+    // code uses it instead of the engine clock so a recorded session replays exactly
+    timestamp_ms_t sim_time;
+    replay_t replay;
+
+    // Sprite animation for every animated entity (advanced once per tick)
+    sprite_animation_system_t animations;
+
+    // Hit sparks and feathers (spawned from game events, never read by the simulation)
+    particle_system_t particles;
+
+    // Sprite quads queued per frame and submitted one geometry call per texture
+    sprite_batch_t sprite_batch;
+
+    // Renderable state handed from the simulation to the renderer each tick
+    render_snapshot_buffer_t snapshots;
+    bool simulation_thread;         // The playing stage simulates on its own thread while the main thread renders
+    SDL_atomic_t simulation_paused; // Set by the main loop while the window is suspended
+
+    // CPU render backend for the playing screen (selected at startup)
+    software_renderer_t software_renderer;
+
+    // Crab respawn waves
+    wave_manager_t crab_waves;
+    int crabs_with_bricks; // Crabs currently carrying a brick (capped at MAX_CRABS_WITH_BRICKS)
 
     // Game statistics
     int lives;
@@ -107,6 +185,16 @@ typedef game_t *game_ptr;
  */
 bool game_init(game_t *game);
 
+/**
+ * Start a new game in place
+ * Resets score, lives, duck and all entity pools and switches to the playing
+ * stage, keeping graphics, audio and fonts loaded. Entities are spawned at
+ * game->sim_time, which the caller sets first.
+ *
+ * @param game Pointer to game structure to restart
+ */
+void game_restart(game_t *game);
+
 /**
  * Clean up and terminate the game
  * Frees all resources and shuts down SDL subsystems
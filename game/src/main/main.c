@@ -1,21 +1,79 @@
 #include "constants.h"
+#include "events.h"
 #include "frame_limiter.h"
 #include "game.h"
+#include "replay_export.h"
 #include "stage_director.h"
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 int main(int argc, char *argv[]) {
-    (void)argc;
-    (void)argv;
-
     game_t game = {0};
+    const char *record_path = NULL;
+    const char *replay_path = NULL;
+    const char *video_path = NULL;
+    bool single_thread = false;
+
+    // Render backend options (read before init, which loads the backend's resources)
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--software-renderer") == 0) {
+            game.software_renderer.enabled = true;
+        } else if (strcmp(argv[i], "--frame-hashes") == 0) {
+            game.software_renderer.print_frame_hashes = true;
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (strcmp(argv[i], "--export-video") == 0 && i + 1 < argc) {
+            video_path = argv[++i];
+        } else if (strcmp(argv[i], "--single-thread") == 0) {
+            single_thread = true;
+        }
+    }
+
+    if (video_path && !replay_path) {
+        printf("--export-video needs a recording to play: --replay <file>\n");
+        return 1;
+    }
+
+    // Exporting draws on the CPU into a framebuffer that is never shown, and stays silent. The dummy video driver
+    // and the software SDL renderer mean no window opens and no GPU is needed, so it also runs without a display
+    if (video_path) {
+        game.software_renderer.enabled = true;
+        game.software_renderer.offscreen = true;
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+        SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+    }
 
     if (!game_init(&game)) {
         game_terminate(&game);
         return 1;
     }
 
+    // Gameplay simulates beside the renderer, except when an export needs the two in lockstep
+    game.simulation_thread = !single_thread && !video_path;
+
+    // A replay starts straight in the playing stage, which begins the session
+    if (replay_path) {
+        if (!replay_open_playback(&game.replay, replay_path)) {
+            game_terminate(&game);
+            return 1;
+        }
+        game.current_screen = SCREEN_GAME;
+    } else if (record_path && !replay_open_record(&game.replay, record_path)) {
+        game_terminate(&game);
+        return 1;
+    }
+
+    if (video_path) {
+        bool exported = replay_export_run(&game, video_path);
+        replay_close(&game.replay);
+        game_terminate(&game);
+        return exported ? 0 : 1;
+    }
+
     printf("Deadly Duck - Press ESC to quit\n");
     printf("Sprite sheet dimensions: %dx%d (%.2f:1 ratio)\n", game.sprite_sheet.width, game.sprite_sheet.height,
            (float)game.sprite_sheet.width / game.sprite_sheet.height);
@@ -33,19 +91,35 @@ int main(int argc, char *argv[]) {
 
     // Game loop
     while (game.running) {
-        // Update stages and handle transitions
-        game_stage_action_t action = stage_director_update(&stage_director, &game);
+        frame_pacing_begin(&game.pacing);
+
+        bool suspended = frame_pacing_check_suspended(&game.pacing, &game.graphics_context);
+        SDL_AtomicSet(&game.simulation_paused, suspended);
 
-        if (action == QUIT) {
-            game.running = false;
+        if (suspended) {
+            // Nothing runs while the window is out of sight or focus, but a quit request still ends the game
+            if (poll_event() == QUIT_EVENT) {
+                game.running = false;
+            }
+        } else {
+            // Update stages and handle transitions
+            game_stage_action_t action = stage_director_update(&stage_director, &game);
+
+            if (action == QUIT) {
+                game.running = false;
+            }
         }
 
-        // Frame rate limiting using engine
-        frame_limiter_wait(&frame_limiter);
+        // Frame rate limiting, or sleeping until input or the next change if nothing was drawn
+        frame_pacing_wait(&game.pacing, &frame_limiter);
     }
 
+    printf("Frames presented %llu, skipped %llu\n", (unsigned long long)game.pacing.presented_frames,
+           (unsigned long long)game.pacing.skipped_frames);
+
     // Cleanup
     stage_director_cleanup(&stage_director);
+    replay_close(&game.replay);
     game_terminate(&game);
     return 0;
 }
@@ -0,0 +1,55 @@
+/**
+ * @file replay_export.c
+ * @brief Headless replay-to-video export implementation
+ */
+
+#include "replay_export.h"
+
+#include "constants.h"
+#include "stage.h"
+#include "video_writer.h"
+#include <stdio.h>
+
+bool replay_export_run(game_ptr game, const char *video_path) {
+    video_writer_t writer;
+    if (!video_writer_open(&writer, video_path, LOGICAL_WIDTH, LOGICAL_HEIGHT, 1000 / FRAME_DELAY)) {
+        return false;
+    }
+
+    // The playing stage on its own, without the director: no title, no game over screen
+    stage_ptr stage = create_playing_stage_instance();
+    if (stage) {
+        game->current_screen = SCREEN_GAME;
+        stage->init(stage, game);
+    }
+    if (!stage || !stage->state) {
+        printf("Failed to start the playing stage for export\n");
+        destroy_stage(stage);
+        video_writer_close(&writer);
+        return false;
+    }
+
+    uint64_t start = SDL_GetPerformanceCounter();
+    uint64_t frames = 0;
+
+    // An update that ends the game (recording exhausted) draws nothing; the one that ends in a game over does
+    while (game->running && game->current_screen == SCREEN_GAME) {
+        stage->update(stage);
+        if (!game->running) {
+            break;
+        }
+
+        video_writer_push(&writer, &game->software_renderer.framebuffer);
+        frames++;
+    }
+
+    destroy_stage(stage);
+
+    // Includes the wait for the writer to finish the frames still queued
+    bool written = video_writer_close(&writer);
+    double seconds = (double)(SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+    printf("Exported %llu frames to %s in %.2f s (%.1f frames per second, %llu waits for the writer)%s\n",
+           (unsigned long long)frames, video_path, seconds, seconds > 0.0 ? (double)frames / seconds : 0.0,
+           (unsigned long long)writer.stalls, written ? "" : " - writing failed");
+    return written;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file replay_export.h
+ * @brief Headless replay-to-video export
+ *
+ * Plays a recorded session back through the playing stage with no frame
+ * limiter and no presentation: every tick is simulated with the recorded
+ * clock and input, drawn by the software renderer into its offscreen
+ * framebuffer and handed to the video writer, whose thread does all of the
+ * file I/O. The export therefore runs as fast as simulation and drawing
+ * allow, typically many times faster than the session was played.
+ */
+
+#ifndef GAME_SRC_MAIN_REPLAY_EXPORT_H_
+#define GAME_SRC_MAIN_REPLAY_EXPORT_H_
+
+#include "game.h"
+#include <stdbool.h>
+
+/**
+ * @brief Export a replay to a .y4m video, one frame per tick
+ *
+ * The game must have been initialized with the software renderer enabled
+ * and offscreen, and with game->replay open for playback. The export ends
+ * with the recording or when the game is over.
+ *
+ * @param game Game state
+ * @param video_path Output .y4m file
+ * @return true if every frame was written
+ */
+bool replay_export_run(game_ptr game, const char *video_path);
+
+#endif // GAME_SRC_MAIN_REPLAY_EXPORT_H_
@@ -21,6 +21,11 @@ bool load_game_fonts(game_ptr game, const graphics_context_ptr graphics_context)
 }
 
 void free_game_fonts(game_ptr game) {
-    // Free bitmap font
-    free_bitmap_font(&game->font);
+    // Strings cached from the font go first
+    cached_text_destroy(&game->score_text);
+
+    // Free bitmap font, never loaded by an offscreen export
+    if (game->font.texture.texture) {
+        free_bitmap_font(&game->font);
+    }
 }
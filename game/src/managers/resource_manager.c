@@ -9,6 +9,7 @@
 #include "constants.h"
 #include "font_loader.h"
 #include "graphics.h"
+#include "render_layer.h"
 #include "texture_loader.h"
 
 bool load_game_resources(game_ptr game) {
@@ -19,13 +20,16 @@ bool load_game_resources(game_ptr game) {
     // Set logical size to fixed dimensions from constants for pixel-perfect rendering
     set_logical_size(&game->graphics_context, LOGICAL_WIDTH, LOGICAL_HEIGHT);
 
+    // Render targets lose their contents on a device reset; count the resets so they get redrawn
+    render_layer_watch_resets(&game->render_target_resets);
+
     // Load textures using focused texture loader
     if (!load_game_textures(game, &game->graphics_context)) {
         return false;
     }
 
-    // Load fonts using focused font loader
-    if (!load_game_fonts(game, &game->graphics_context)) {
+    // Load fonts using focused font loader; an offscreen export draws text from the software renderer's copy
+    if (!game->software_renderer.offscreen && !load_game_fonts(game, &game->graphics_context)) {
         return false;
     }
 
@@ -42,6 +46,7 @@ void free_game_resources(game_ptr game) {
     free_game_fonts(game);
     free_game_textures(game);
     free_game_audio(game);
+    render_layer_unwatch_resets(&game->render_target_resets);
 
     // Terminate graphics context (handles window, renderer, SDL cleanup)
     terminate_graphics_context(&game->graphics_context);
@@ -10,10 +10,27 @@
 #include "constants.h"
 #include "texture.h"
 
+// Sprite atlas packed by atlas_packer, loaded as a texture and, for the software renderer, into system memory
+static const char *SPRITE_SHEET_PATH = "game/assets/sprites/sprite_atlas.png";
+
+// The arcade font load_game_fonts gives the engine, copied into system memory for the software renderer's HUD
+static const char *FONT_PATH = "game/assets/sprites/arcade-font.png";
+
 bool load_game_textures(game_ptr game, const graphics_context_ptr graphics_context) {
-    // Load sprite sheet using engine abstraction with white color key
-    game->sprite_sheet = load_texture_with_colorkey(graphics_context->renderer,
-                                                    "game/assets/sprites/sprite_sheet_pixelart.png", 255, 255, 255);
+    // An offscreen export only ever draws into the software framebuffer, so it loads no GPU textures or render
+    // targets; the software lake is filled straight from the gradient, without a baked column
+    if (game->software_renderer.offscreen) {
+        game->lake = (lake_layer_t){.gradient = lake_gradient_classic, .width = LOGICAL_WIDTH, .height = LAKE_HEIGHT};
+        if (!software_renderer_init(&game->software_renderer, graphics_context, SPRITE_SHEET_PATH, FONT_PATH,
+                                    LOGICAL_WIDTH, LOGICAL_HEIGHT)) {
+            printf("Failed to initialize software renderer\n");
+            return false;
+        }
+        return true;
+    }
+
+    // The atlas has real alpha, so it loads as is: no color-key pass, and every sprite comes from this one texture
+    game->sprite_sheet = load_texture(graphics_context->renderer, SPRITE_SHEET_PATH);
     if (!game->sprite_sheet.texture) {
         printf("Failed to load sprite sheet\n");
         return false;
@@ -30,11 +47,41 @@ bool load_game_textures(game_ptr game, const graphics_context_ptr graphics_conte
     game->cover_width = game->cover_image.width;
     game->cover_height = game->cover_image.height;
 
+    // Bake the lake gradient once instead of drawing it line by line every frame
+    if (!lake_layer_bake(&game->lake, graphics_context, lake_gradient_classic, LOGICAL_WIDTH, LAKE_HEIGHT)) {
+        printf("Failed to bake lake gradient\n");
+        return false;
+    }
+
+    // Background and HUD are drawn into render targets and only redrawn when they change
+    if (!render_layer_init(&game->background_layer, graphics_context, LOGICAL_WIDTH, LOGICAL_HEIGHT,
+                           SDL_BLENDMODE_NONE) ||
+        !render_layer_init(&game->hud_layer, graphics_context, LOGICAL_WIDTH, LOGICAL_HEIGHT, SDL_BLENDMODE_BLEND)) {
+        printf("Failed to create render layers\n");
+        return false;
+    }
+
+    // Framebuffer and CPU sprite sheet, only when the software renderer was selected at startup
+    if (game->software_renderer.enabled &&
+        !software_renderer_init(&game->software_renderer, graphics_context, SPRITE_SHEET_PATH, FONT_PATH,
+                                LOGICAL_WIDTH, LOGICAL_HEIGHT)) {
+        printf("Failed to initialize software renderer\n");
+        return false;
+    }
+
     return true;
 }
 
 void free_game_textures(game_ptr game) {
     // Free textures
-    free_texture(&game->cover_image);
-    free_texture(&game->sprite_sheet);
+    software_renderer_destroy(&game->software_renderer);
+    render_layer_destroy(&game->hud_layer);
+    render_layer_destroy(&game->background_layer);
+    lake_layer_destroy(&game->lake);
+    if (game->cover_image.texture) {
+        free_texture(&game->cover_image);
+    }
+    if (game->sprite_sheet.texture) {
+        free_texture(&game->sprite_sheet);
+    }
 }
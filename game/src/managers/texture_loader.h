@@ -2,8 +2,8 @@
  * @file texture_loader.h
  * @brief Texture resource loading and management
  *
- * Handles loading and freeing of texture assets including sprite sheets
- * and image resources with color key support.
+ * Handles loading and freeing of texture assets including the sprite atlas
+ * and image resources.
  */
 
 #ifndef TEXTURE_LOADER_H
@@ -0,0 +1,40 @@
+/**
+ * @file wave_manager.c
+ * @brief Scheduled crab respawn waves implementation
+ */
+
+#include "wave_manager.h"
+
+#include "crab.h"
+#include "entity_factory.h"
+
+void wave_manager_init(wave_manager_ptr manager, size_t target_population, timestamp_ms_t current_time) {
+    manager->next_wave_time = current_time + CRAB_WAVE_INTERVAL_MS;
+    manager->target_population = target_population;
+    manager->wave_number = 0;
+}
+
+size_t wave_manager_update(wave_manager_ptr manager, entity_pool_t *crab_pool, timer_wheel_ptr timers,
+                           sprite_animation_system_ptr animations, motion_event_queue_ptr events, sim_tick_t tick,
+                           timestamp_ms_t current_time) {
+    if (current_time < manager->next_wave_time) {
+        return 0;
+    }
+
+    manager->next_wave_time = current_time + CRAB_WAVE_INTERVAL_MS;
+
+    if (crab_pool->active_count >= manager->target_population) {
+        return 0; // Nobody to replace this time
+    }
+
+    // Replace destroyed crabs, walking in from the screen edges
+    crab_t prototype = make_crab_prototype();
+    size_t missing = manager->target_population - crab_pool->active_count;
+    size_t spawned = spawn_crabs_from_prototype(crab_pool, timers, animations, events, &prototype, missing, tick,
+                                                current_time, true);
+    if (spawned > 0) {
+        manager->wave_number++;
+    }
+
+    return spawned;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file wave_manager.h
+ * @brief Scheduled crab respawn waves
+ *
+ * Destroyed crabs are released back to the crab pool. The wave manager
+ * tops the population back up on a fixed schedule, with new crabs walking
+ * in from the screen edges.
+ */
+
+#ifndef WAVE_MANAGER_H
+#define WAVE_MANAGER_H
+
+#include "entity_pool.h"
+#include "motion_events.h"
+#include "sprite_animation.h"
+#include "timer_wheel.h"
+#include "types.h"
+#include <stddef.h>
+
+// Time between respawn waves
+#define CRAB_WAVE_INTERVAL_MS 6000
+
+/**
+ * @brief Crab wave schedule state
+ */
+typedef struct {
+    timestamp_ms_t next_wave_time; // When the next respawn wave is due
+    size_t target_population;      // Crab count each wave tops the population back up to
+    int wave_number;               // Respawn waves spawned since the game started
+} wave_manager_t;
+
+typedef wave_manager_t *wave_manager_ptr;
+
+/**
+ * @brief Start the wave schedule
+ * @param manager Wave manager to initialize
+ * @param target_population Number of crabs each wave restores
+ * @param current_time Current game time
+ */
+void wave_manager_init(wave_manager_ptr manager, size_t target_population, timestamp_ms_t current_time);
+
+/**
+ * @brief Spawn a respawn wave if one is due
+ * @param manager Wave manager
+ * @param crab_pool Object pool for crabs
+ * @param timers Timer wheel for the new crabs' drop timers
+ * @param animations Animation system for the new crabs' animations
+ * @param events Motion event queue for the new crabs' wrap events
+ * @param tick Current simulation tick
+ * @param current_time Current game time
+ * @return Number of crabs spawned this tick
+ */
+size_t wave_manager_update(wave_manager_ptr manager, entity_pool_t *crab_pool, timer_wheel_ptr timers,
+                           sprite_animation_system_ptr animations, motion_event_queue_ptr events, sim_tick_t tick,
+                           timestamp_ms_t current_time);
+
+#endif // WAVE_MANAGER_H
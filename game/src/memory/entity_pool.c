@@ -0,0 +1,252 @@
+/**
+ * @file entity_pool.c
+ * @brief Cache-line aligned, chunk-growable entity pool implementation
+ */
+
+#include "entity_pool.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t padded_stride(size_t element_size) {
+    // Small elements are padded to a power of two so they never straddle a cache line
+    if (element_size <= ENTITY_POOL_ALIGNMENT) {
+        size_t stride = 1;
+        while (stride < element_size) {
+            stride <<= 1;
+        }
+        return stride;
+    }
+
+    // Larger elements start on a cache line boundary
+    return (element_size + ENTITY_POOL_ALIGNMENT - 1) & ~(size_t)(ENTITY_POOL_ALIGNMENT - 1);
+}
+
+static bool add_chunk(entity_pool_t *pool) {
+    if (pool->chunk_count >= pool->max_chunks) {
+        return false;
+    }
+
+    size_t chunk_capacity = pool->chunk_mask + 1;
+    size_t chunk_bytes = chunk_capacity * pool->stride;
+
+    // Over-allocate so the chunk can start on a cache line boundary
+    void *block = malloc(chunk_bytes + ENTITY_POOL_ALIGNMENT - 1);
+    if (!block) {
+        return false;
+    }
+
+    uintptr_t aligned = ((uintptr_t)block + ENTITY_POOL_ALIGNMENT - 1) & ~(uintptr_t)(ENTITY_POOL_ALIGNMENT - 1);
+    memset((void *)aligned, 0, chunk_bytes);
+
+    pool->chunk_blocks[pool->chunk_count] = block;
+    pool->chunks[pool->chunk_count] = (unsigned char *)aligned;
+    pool->chunk_count++;
+
+    // New slots join the untouched tail and are bump-allocated in order
+    pool->capacity += chunk_capacity;
+    if (pool->capacity > pool->max_capacity) {
+        pool->capacity = pool->max_capacity;
+    }
+
+    return true;
+}
+
+entity_pool_t create_growable_entity_pool(size_t element_size, size_t chunk_capacity, size_t max_capacity) {
+    entity_pool_t pool;
+    memset(&pool, 0, sizeof(pool));
+
+    if (element_size == 0 || chunk_capacity == 0 || max_capacity == 0) {
+        return pool;
+    }
+
+    // Power-of-two chunks turn slot lookup into a shift and a mask
+    size_t chunk_shift = 0;
+    while (((size_t)1 << chunk_shift) < chunk_capacity) {
+        chunk_shift++;
+    }
+    size_t rounded_chunk = (size_t)1 << chunk_shift;
+    size_t max_chunks = (max_capacity + rounded_chunk - 1) / rounded_chunk;
+
+    pool.chunks = calloc(max_chunks, sizeof(unsigned char *));
+    pool.chunk_blocks = calloc(max_chunks, sizeof(void *));
+    pool.slot_epochs = calloc(max_capacity, sizeof(uint32_t));
+    pool.free_indices = malloc(max_capacity * sizeof(size_t));
+    pool.live_indices = malloc(max_capacity * sizeof(size_t));
+    pool.live_positions = malloc(max_capacity * sizeof(size_t));
+    if (!pool.chunks || !pool.chunk_blocks || !pool.slot_epochs || !pool.free_indices || !pool.live_indices ||
+        !pool.live_positions) {
+        entity_pool_destroy(&pool);
+        return pool;
+    }
+
+    pool.max_chunks = max_chunks;
+    pool.chunk_shift = chunk_shift;
+    pool.chunk_mask = rounded_chunk - 1;
+    pool.element_size = element_size;
+    pool.stride = padded_stride(element_size);
+    pool.max_capacity = max_capacity;
+    pool.epoch = 1;
+
+    if (!add_chunk(&pool)) {
+        entity_pool_destroy(&pool);
+    }
+
+    return pool;
+}
+
+// Pop a recycled slot (or take the next untouched one) and append it to the live list;
+// the caller checks for space first
+static inline size_t take_free_slot(entity_pool_t *pool) {
+    size_t slot = pool->free_count > 0 ? pool->free_indices[--pool->free_count] : pool->used_slots++;
+    pool->slot_epochs[slot] = pool->epoch;
+    pool->live_positions[slot] = pool->active_count;
+    pool->live_indices[pool->active_count++] = slot;
+    return slot;
+}
+
+// Number of slots that can be handed out without growing
+static inline size_t available_slots(const entity_pool_t *pool) {
+    return pool->free_count + (pool->capacity - pool->used_slots);
+}
+
+entity_pool_t create_entity_pool(size_t element_size, size_t capacity) {
+    return create_growable_entity_pool(element_size, capacity, capacity);
+}
+
+void *entity_pool_acquire(entity_pool_t *pool, size_t *index) {
+    if (!pool) {
+        return NULL;
+    }
+
+    if (available_slots(pool) == 0) {
+        if (!add_chunk(pool)) {
+            pool->stats.acquire_failures++;
+            return NULL; // Pool is at its maximum capacity
+        }
+        pool->stats.growth_events++;
+    }
+
+    size_t slot = take_free_slot(pool);
+
+    pool->stats.acquire_count++;
+    if (pool->active_count > pool->stats.high_water_mark) {
+        pool->stats.high_water_mark = pool->active_count;
+    }
+
+    if (index) {
+        *index = slot;
+    }
+
+    return entity_pool_slot(pool, slot);
+}
+
+size_t entity_pool_acquire_n(entity_pool_t *pool, size_t count, size_t *indices) {
+    if (!pool || !indices) {
+        return 0;
+    }
+
+    size_t acquired = 0;
+    while (acquired < count) {
+        size_t available = available_slots(pool);
+        if (available == 0) {
+            if (!add_chunk(pool)) {
+                pool->stats.acquire_failures += count - acquired;
+                break; // Pool is at its maximum capacity
+            }
+            pool->stats.growth_events++;
+            continue;
+        }
+
+        // Take as many slots as the current chunks can provide in one run
+        size_t take = count - acquired;
+        if (take > available) {
+            take = available;
+        }
+        for (size_t i = 0; i < take; i++) {
+            indices[acquired + i] = take_free_slot(pool);
+        }
+        acquired += take;
+    }
+
+    pool->stats.acquire_count += acquired;
+    if (pool->active_count > pool->stats.high_water_mark) {
+        pool->stats.high_water_mark = pool->active_count;
+    }
+
+    return acquired;
+}
+
+void entity_pool_release(entity_pool_t *pool, size_t index) {
+    if (!pool || !entity_pool_is_active(pool, index)) {
+        return;
+    }
+
+    pool->slot_epochs[index] = 0;
+    pool->free_indices[pool->free_count++] = index;
+
+    // Swap-remove from the live list to keep it dense
+    size_t position = pool->live_positions[index];
+    size_t last = pool->live_indices[--pool->active_count];
+    pool->live_indices[position] = last;
+    pool->live_positions[last] = position;
+}
+
+void entity_pool_reset(entity_pool_t *pool) {
+    if (!pool || !pool->slot_epochs) {
+        return;
+    }
+
+    // A new epoch retires every slot without touching them
+    pool->epoch++;
+    if (pool->epoch == 0) {
+        // Epoch wrapped: clear stale tags once so no slot matches by accident
+        memset(pool->slot_epochs, 0, pool->max_capacity * sizeof(uint32_t));
+        pool->epoch = 1;
+    }
+
+    pool->free_count = 0;
+    pool->used_slots = 0;
+    pool->active_count = 0;
+}
+
+entity_pool_stats_t entity_pool_get_stats(const entity_pool_t *pool) {
+    entity_pool_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    if (pool) {
+        stats = pool->stats;
+    }
+    return stats;
+}
+
+void entity_pool_print_stats(const entity_pool_t *pool, const char *name) {
+    if (!pool) {
+        return;
+    }
+
+    printf("Pool %-10s peak %4zu / capacity %4zu (max %4zu), acquires %6zu, failures %4zu, growths %3zu\n", name,
+           pool->stats.high_water_mark, pool->capacity, pool->max_capacity, pool->stats.acquire_count,
+           pool->stats.acquire_failures, pool->stats.growth_events);
+}
+
+void entity_pool_destroy(entity_pool_t *pool) {
+    if (!pool) {
+        return;
+    }
+
+    if (pool->chunk_blocks) {
+        for (size_t i = 0; i < pool->chunk_count; i++) {
+            free(pool->chunk_blocks[i]);
+        }
+    }
+
+    free(pool->chunks);
+    free(pool->chunk_blocks);
+    free(pool->slot_epochs);
+    free(pool->free_indices);
+    free(pool->live_indices);
+    free(pool->live_positions);
+    memset(pool, 0, sizeof(*pool));
+}
@@ -0,0 +1,249 @@
+/**
+ * @file entity_pool.h
+ * @brief Cache-line aligned, chunk-growable object pool for game entities
+ *
+ * Stores entities in 64-byte aligned chunks with the element stride padded
+ * so that small entities never straddle a cache line. When a pool runs out
+ * of free slots it grows by one chunk, up to a fixed maximum capacity.
+ * Chunks are never moved, so element addresses stay valid for as long as
+ * the element is active. Each pool records a high-water mark, acquire
+ * failures and growth events so capacities can be tuned from real data.
+ *
+ * Slots are handed out from a free stack first and then bump-allocated
+ * from the untouched tail, and a slot counts as active only while it carries
+ * the pool's current epoch. Together these make entity_pool_reset() O(1):
+ * it bumps the epoch and rewinds the tail instead of touching every slot.
+ *
+ * Active slots are also kept in a dense live list, so iteration costs
+ * O(active elements) no matter how many slots were ever used. The iterator
+ * walks that list and prefetches a few elements ahead, so the update and
+ * render loops don't stall on a dependent load for every entity. Releasing
+ * the current element through the iterator is safe; releasing any other
+ * element of the same pool mid-iteration may cause one element to be skipped.
+ */
+
+#ifndef GAME_SRC_MEMORY_ENTITY_POOL_H_
+#define GAME_SRC_MEMORY_ENTITY_POOL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Cache line size used for the storage base and stride padding
+#define ENTITY_POOL_ALIGNMENT 64
+
+// How many slots ahead of the current element the iterator prefetches
+#define ENTITY_POOL_PREFETCH_DISTANCE 4
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ENTITY_POOL_PREFETCH(address) __builtin_prefetch((address), 1, 3)
+#else
+#define ENTITY_POOL_PREFETCH(address) ((void)(address))
+#endif
+
+/**
+ * Entity pool occupancy telemetry
+ */
+typedef struct {
+    size_t high_water_mark;  // Peak number of simultaneously active elements
+    size_t acquire_count;    // Successful acquires
+    size_t acquire_failures; // Elements refused because the pool hit its maximum capacity
+    size_t growth_events;    // Chunks added after the pool was created
+} entity_pool_stats_t;
+
+/**
+ * Entity pool structure
+ */
+typedef struct {
+    unsigned char **chunks;    // Element storage chunks, each aligned to ENTITY_POOL_ALIGNMENT
+    void **chunk_blocks;       // Raw allocations backing each chunk
+    size_t chunk_count;        // Number of allocated chunks
+    size_t max_chunks;         // Number of chunks needed to reach max_capacity
+    size_t chunk_shift;        // log2 of slots per chunk
+    size_t chunk_mask;         // Slots per chunk minus one
+    uint32_t *slot_epochs;     // Per-slot epoch, equal to epoch while the slot is active
+    uint32_t epoch;            // Current epoch (never 0)
+    size_t *free_indices;      // Stack of released slot indices below used_slots
+    size_t free_count;         // Number of entries in free_indices
+    size_t used_slots;         // Slots at or above this index have never been handed out
+    size_t *live_indices;      // Dense list of active slot indices (active_count entries)
+    size_t *live_positions;    // Position of each active slot inside live_indices
+    size_t element_size;       // Size of one element as requested
+    size_t stride;             // Distance between elements (padded element size)
+    size_t capacity;           // Slots currently backed by storage
+    size_t max_capacity;       // Upper bound on capacity
+    size_t active_count;       // Number of slots currently in use
+    entity_pool_stats_t stats; // Occupancy telemetry
+} entity_pool_t;
+
+// Pointer typedef for entity pool
+typedef entity_pool_t *entity_pool_ptr;
+
+/**
+ * Entity pool iterator (visits active slots in live list order)
+ */
+typedef struct {
+    entity_pool_t *pool;
+    size_t next;   // Next live list position to visit
+    size_t index;  // Slot index of the current element
+    void *element; // Current element
+} entity_pool_iter_t;
+
+/**
+ * @brief Create a fixed-capacity aligned entity pool
+ * @param element_size Size of a single element in bytes
+ * @param capacity Number of elements the pool can hold
+ * @return Initialized pool (capacity is 0 if allocation failed)
+ */
+entity_pool_t create_entity_pool(size_t element_size, size_t capacity);
+
+/**
+ * @brief Create an aligned entity pool that grows in fixed-size chunks
+ * @param element_size Size of a single element in bytes
+ * @param chunk_capacity Elements per chunk (rounded up to a power of two)
+ * @param max_capacity Maximum number of elements the pool may grow to
+ * @return Initialized pool holding one chunk (capacity is 0 if allocation failed)
+ */
+entity_pool_t create_growable_entity_pool(size_t element_size, size_t chunk_capacity, size_t max_capacity);
+
+/**
+ * @brief Acquire a free element from the pool, growing it if needed
+ * @param pool Entity pool
+ * @param index Output slot index of the acquired element (may be NULL)
+ * @return Pointer to the element, NULL if the pool is at its maximum capacity
+ */
+void *entity_pool_acquire(entity_pool_t *pool, size_t *index);
+
+/**
+ * @brief Acquire several elements in one call, growing the pool as needed
+ * @param pool Entity pool
+ * @param count Number of elements wanted
+ * @param indices Output array of at least count slot indices
+ * @return Number of elements actually acquired (less than count if the pool hit its maximum capacity)
+ */
+size_t entity_pool_acquire_n(entity_pool_t *pool, size_t count, size_t *indices);
+
+/**
+ * @brief Return an element to the pool
+ * @param pool Entity pool
+ * @param index Slot index of the element to release
+ */
+void entity_pool_release(entity_pool_t *pool, size_t index);
+
+/**
+ * @brief Release every element at once in O(1), keeping the allocated chunks
+ * @param pool Entity pool (statistics are kept so they cover the whole session)
+ */
+void entity_pool_reset(entity_pool_t *pool);
+
+/**
+ * @brief Get the occupancy telemetry of a pool
+ * @param pool Entity pool
+ * @return Copy of the pool statistics
+ */
+entity_pool_stats_t entity_pool_get_stats(const entity_pool_t *pool);
+
+/**
+ * @brief Print a one-line occupancy report for a pool
+ * @param pool Entity pool
+ * @param name Pool name shown in the report
+ */
+void entity_pool_print_stats(const entity_pool_t *pool, const char *name);
+
+/**
+ * @brief Free all memory owned by the pool
+ * @param pool Entity pool to destroy
+ */
+void entity_pool_destroy(entity_pool_t *pool);
+
+/**
+ * @brief Check whether a slot is in use
+ * @param pool Entity pool
+ * @param index Slot index
+ * @return true if the slot holds an active element
+ */
+static inline bool entity_pool_is_active(const entity_pool_t *pool, size_t index) {
+    return index < pool->used_slots && pool->slot_epochs[index] == pool->epoch;
+}
+
+/**
+ * @brief Address of a slot without range checking
+ * @param pool Entity pool
+ * @param index Slot index (must be below capacity)
+ * @return Pointer to the slot storage
+ */
+static inline void *entity_pool_slot(const entity_pool_t *pool, size_t index) {
+    return pool->chunks[index >> pool->chunk_shift] + (index & pool->chunk_mask) * pool->stride;
+}
+
+/**
+ * @brief Get the element stored at a slot
+ * @param pool Entity pool
+ * @param index Slot index
+ * @return Pointer to the element, NULL if index is out of range
+ */
+static inline void *entity_pool_get_at(const entity_pool_t *pool, size_t index) {
+    if (index >= pool->capacity)
+        return NULL;
+
+    return entity_pool_slot(pool, index);
+}
+
+/**
+ * @brief Start iterating over the active elements of a pool
+ * @param pool Entity pool
+ * @return Iterator positioned before the first active element
+ */
+static inline entity_pool_iter_t entity_pool_iter(entity_pool_t *pool) {
+    entity_pool_iter_t iter = {pool, 0, 0, NULL};
+    return iter;
+}
+
+/**
+ * @brief Start iterating part way through the live list
+ * @param pool Entity pool
+ * @param position Live list position of the first element to visit (past the end visits nothing)
+ * @return Iterator positioned before the element at that position
+ */
+static inline entity_pool_iter_t entity_pool_iter_at(entity_pool_t *pool, size_t position) {
+    entity_pool_iter_t iter = {pool, position, 0, NULL};
+    return iter;
+}
+
+/**
+ * @brief Advance to the next active element, prefetching ahead
+ * @param iter Iterator
+ * @return true if iter->element now points at an active element
+ */
+static inline bool entity_pool_iter_next(entity_pool_iter_t *iter) {
+    entity_pool_t *pool = iter->pool;
+
+    if (iter->next >= pool->active_count) {
+        iter->element = NULL;
+        return false;
+    }
+
+    size_t position = iter->next++;
+
+    // Pull a later element into cache while the caller works on this one
+    if (position + ENTITY_POOL_PREFETCH_DISTANCE < pool->active_count) {
+        ENTITY_POOL_PREFETCH(entity_pool_slot(pool, pool->live_indices[position + ENTITY_POOL_PREFETCH_DISTANCE]));
+    }
+
+    iter->index = pool->live_indices[position];
+    iter->element = entity_pool_slot(pool, iter->index);
+    return true;
+}
+
+/**
+ * @brief Release the element the iterator currently points at
+ * @param iter Iterator (stays valid, the next call continues after the element)
+ */
+static inline void entity_pool_iter_release(entity_pool_iter_t *iter) {
+    entity_pool_release(iter->pool, iter->index);
+
+    // The last live element was swapped into the released position; visit it next
+    iter->next--;
+}
+
+#endif // GAME_SRC_MEMORY_ENTITY_POOL_H_
@@ -0,0 +1,193 @@
+/**
+ * @file ring_pool.c
+ * @brief Lifetime-ordered ring buffer pool implementation
+ */
+
+#include "ring_pool.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static size_t padded_stride(size_t element_size) {
+    // Same padding as entity pools: small elements never straddle a cache line
+    if (element_size <= ENTITY_POOL_ALIGNMENT) {
+        size_t stride = 1;
+        while (stride < element_size) {
+            stride <<= 1;
+        }
+        return stride;
+    }
+
+    return (element_size + ENTITY_POOL_ALIGNMENT - 1) & ~(size_t)(ENTITY_POOL_ALIGNMENT - 1);
+}
+
+static bool add_segment(ring_pool_t *pool) {
+    if (pool->segment_count >= pool->max_segments) {
+        return false;
+    }
+
+    size_t segment_capacity = pool->mask + 1;
+    size_t segment_bytes = segment_capacity * pool->stride;
+
+    // Over-allocate so the storage can start on a cache line boundary
+    void *block = malloc(segment_bytes + ENTITY_POOL_ALIGNMENT - 1);
+    uint8_t *alive = calloc(segment_capacity, sizeof(uint8_t));
+    if (!block || !alive) {
+        free(block);
+        free(alive);
+        return false;
+    }
+
+    uintptr_t aligned = ((uintptr_t)block + ENTITY_POOL_ALIGNMENT - 1) & ~(uintptr_t)(ENTITY_POOL_ALIGNMENT - 1);
+    memset((void *)aligned, 0, segment_bytes);
+
+    ring_segment_t *segment = &pool->segments[pool->segment_count++];
+    segment->elements = (unsigned char *)aligned;
+    segment->block = block;
+    segment->alive = alive;
+    segment->head = 0;
+    segment->tail = 0;
+
+    pool->capacity += segment_capacity;
+    return true;
+}
+
+// Full when the tail catches up with the oldest held slot, tombstones included
+static inline bool segment_full(const ring_pool_t *pool, const ring_segment_t *segment) {
+    return segment->tail - segment->head > pool->mask;
+}
+
+ring_pool_t create_ring_pool(size_t element_size, size_t segment_capacity, size_t max_capacity) {
+    ring_pool_t pool;
+    memset(&pool, 0, sizeof(pool));
+
+    if (element_size == 0 || segment_capacity == 0 || max_capacity == 0) {
+        return pool;
+    }
+
+    // Power-of-two segments turn position-to-slot into a mask
+    size_t shift = 0;
+    while (((size_t)1 << shift) < segment_capacity) {
+        shift++;
+    }
+    size_t rounded = (size_t)1 << shift;
+
+    pool.max_segments = (max_capacity + rounded - 1) / rounded;
+    pool.segments = calloc(pool.max_segments, sizeof(ring_segment_t));
+    if (!pool.segments) {
+        memset(&pool, 0, sizeof(pool));
+        return pool;
+    }
+
+    pool.segment_shift = shift;
+    pool.mask = rounded - 1;
+    pool.element_size = element_size;
+    pool.stride = padded_stride(element_size);
+    pool.max_capacity = pool.max_segments * rounded;
+
+    if (!add_segment(&pool)) {
+        ring_pool_destroy(&pool);
+    }
+    return pool;
+}
+
+void *ring_pool_acquire(ring_pool_t *pool, size_t *index) {
+    if (!pool || pool->segment_count == 0) {
+        return NULL;
+    }
+
+    if (segment_full(pool, &pool->segments[pool->append_segment])) {
+        // Move to the first segment whose head has drained enough, or chain a new one
+        size_t candidate = 0;
+        while (candidate < pool->segment_count && segment_full(pool, &pool->segments[candidate])) {
+            candidate++;
+        }
+
+        if (candidate == pool->segment_count) {
+            if (!add_segment(pool)) {
+                pool->stats.acquire_failures++;
+                return NULL; // Pool is at its maximum capacity
+            }
+            pool->stats.growth_events++;
+        }
+        pool->append_segment = candidate;
+    }
+
+    ring_segment_t *segment = &pool->segments[pool->append_segment];
+    size_t slot = segment->tail++ & pool->mask;
+    segment->alive[slot] = 1;
+    pool->active_count++;
+
+    pool->stats.acquire_count++;
+    if (pool->active_count > pool->stats.high_water_mark) {
+        pool->stats.high_water_mark = pool->active_count;
+    }
+
+    if (index) {
+        *index = (pool->append_segment << pool->segment_shift) | slot;
+    }
+
+    return segment->elements + slot * pool->stride;
+}
+
+void ring_pool_release(ring_pool_t *pool, size_t index) {
+    if (!pool || index >= pool->capacity) {
+        return;
+    }
+
+    ring_segment_t *segment = &pool->segments[index >> pool->segment_shift];
+    size_t slot = index & pool->mask;
+
+    // Slots outside the held range carry stale flags from before the last reset
+    size_t offset = (slot - segment->head) & pool->mask;
+    if (offset >= segment->tail - segment->head || !segment->alive[slot]) {
+        return;
+    }
+
+    segment->alive[slot] = 0;
+    pool->active_count--;
+
+    // Pop the head past this element and every tombstone queued behind it
+    while (segment->head < segment->tail && !segment->alive[segment->head & pool->mask]) {
+        segment->head++;
+    }
+}
+
+void ring_pool_reset(ring_pool_t *pool) {
+    if (!pool) {
+        return;
+    }
+
+    // Alive flags are only read between head and tail, so they need no clearing
+    for (size_t i = 0; i < pool->segment_count; i++) {
+        pool->segments[i].head = 0;
+        pool->segments[i].tail = 0;
+    }
+    pool->append_segment = 0;
+    pool->active_count = 0;
+}
+
+void ring_pool_print_stats(const ring_pool_t *pool, const char *name) {
+    if (!pool) {
+        return;
+    }
+
+    printf("Ring %-10s peak %4zu / capacity %4zu (max %4zu), acquires %6zu, failures %4zu, growths %3zu\n", name,
+           pool->stats.high_water_mark, pool->capacity, pool->max_capacity, pool->stats.acquire_count,
+           pool->stats.acquire_failures, pool->stats.growth_events);
+}
+
+void ring_pool_destroy(ring_pool_t *pool) {
+    if (!pool) {
+        return;
+    }
+
+    for (size_t i = 0; i < pool->segment_count; i++) {
+        free(pool->segments[i].block);
+        free(pool->segments[i].alive);
+    }
+    free(pool->segments);
+    memset(pool, 0, sizeof(*pool));
+}
@@ -0,0 +1,200 @@
+/**
+ * @file ring_pool.h
+ * @brief Lifetime-ordered ring buffer pool for short-lived entities
+ *
+ * Entities that mostly die in the order they were created (shots, landed
+ * bricks) live in cache-line aligned rings. Acquisition appends at the
+ * tail and expiry pops from the head, so the live range of a ring is one
+ * contiguous run of slots (wrapping once at the end of the buffer) and
+ * iteration walks memory in order. An element that dies before the ones in
+ * front of it is left as a tombstone; it is skipped by iteration and
+ * reclaimed as soon as the head reaches it.
+ *
+ * The pool starts as one ring segment and chains another when every
+ * segment is full, up to a maximum capacity, the way entity pools grow by
+ * chunks. New elements go to the first segment with room, so any segment
+ * may hold the newest elements; every segment has its own head, and sweeps
+ * that reclaim expired elements from the head must drain each segment on
+ * its own (ring_pool_iter_at_head, ring_pool_iter_skip_segment). A
+ * long-lived element holding the head of a segment then only ties up that
+ * segment. Segments are never moved, so element addresses and slot indices
+ * stay valid for as long as the element is active.
+ */
+
+#ifndef GAME_SRC_MEMORY_RING_POOL_H_
+#define GAME_SRC_MEMORY_RING_POOL_H_
+
+#include "entity_pool.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * One ring of a ring pool
+ */
+typedef struct {
+    unsigned char *elements; // Element storage, aligned to ENTITY_POOL_ALIGNMENT
+    void *block;             // Raw allocation backing the storage
+    uint8_t *alive;          // Per-slot flag, 0 for tombstones (only valid between head and tail)
+    size_t head;             // Position of the oldest slot still held (slot = position & mask)
+    size_t tail;             // Position the next acquire appends at
+} ring_segment_t;
+
+/**
+ * Ring pool structure
+ */
+typedef struct {
+    ring_segment_t *segments;  // Segments allocated so far (segment_count of max_segments)
+    size_t segment_count;      // Number of allocated segments
+    size_t max_segments;       // Number of segments needed to reach max_capacity
+    size_t segment_shift;      // log2 of slots per segment
+    size_t mask;               // Slots per segment minus one
+    size_t append_segment;     // Segment acquires append to until it fills
+    size_t element_size;       // Size of one element as requested
+    size_t stride;             // Distance between elements (padded element size)
+    size_t capacity;           // Slots currently backed by storage
+    size_t max_capacity;       // Upper bound on capacity
+    size_t active_count;       // Live elements (tombstones excluded)
+    entity_pool_stats_t stats; // Occupancy telemetry
+} ring_pool_t;
+
+// Pointer typedef for ring pool
+typedef ring_pool_t *ring_pool_ptr;
+
+/**
+ * Ring pool iterator (visits live slots segment by segment, oldest to newest within each)
+ */
+typedef struct {
+    ring_pool_t *pool;
+    size_t segment; // Segment being walked
+    size_t next;    // Next ring position to visit in that segment
+    size_t index;   // Slot index of the current element
+    void *element;  // Current element
+} ring_pool_iter_t;
+
+/**
+ * @brief Create a ring pool that chains ring segments as it fills
+ * @param element_size Size of a single element in bytes
+ * @param segment_capacity Elements per segment (rounded up to a power of two)
+ * @param max_capacity Maximum number of elements the pool may grow to
+ * @return Initialized pool holding one segment (capacity is 0 if allocation failed)
+ */
+ring_pool_t create_ring_pool(size_t element_size, size_t segment_capacity, size_t max_capacity);
+
+/**
+ * @brief Append a new element at the tail of a segment with room, chaining a segment if needed
+ * @param pool Ring pool
+ * @param index Output slot index of the acquired element (may be NULL)
+ * @return Pointer to the element, NULL if the pool is at its maximum capacity
+ */
+void *ring_pool_acquire(ring_pool_t *pool, size_t *index);
+
+/**
+ * @brief Kill an element, reclaiming it and any tombstones behind it if it is the oldest of its segment
+ * @param pool Ring pool
+ * @param index Slot index of the element to release
+ */
+void ring_pool_release(ring_pool_t *pool, size_t index);
+
+/**
+ * @brief Release every element at once, keeping the allocated segments
+ * @param pool Ring pool (statistics are kept so they cover the whole session)
+ */
+void ring_pool_reset(ring_pool_t *pool);
+
+/**
+ * @brief Print a one-line occupancy report for a ring pool
+ * @param pool Ring pool
+ * @param name Pool name shown in the report
+ */
+void ring_pool_print_stats(const ring_pool_t *pool, const char *name);
+
+/**
+ * @brief Free all memory owned by the ring pool
+ * @param pool Ring pool to destroy
+ */
+void ring_pool_destroy(ring_pool_t *pool);
+
+/**
+ * @brief Address of a slot without range checking
+ * @param pool Ring pool
+ * @param index Slot index (must be below capacity)
+ * @return Pointer to the slot storage
+ */
+static inline void *ring_pool_slot(const ring_pool_t *pool, size_t index) {
+    return pool->segments[index >> pool->segment_shift].elements + (index & pool->mask) * pool->stride;
+}
+
+/**
+ * @brief Start iterating over the live elements of a ring pool
+ * @param pool Ring pool
+ * @return Iterator positioned before the oldest element of the first segment
+ */
+static inline ring_pool_iter_t ring_pool_iter(ring_pool_t *pool) {
+    ring_pool_iter_t iter = {pool, 0, 0, 0, NULL};
+    return iter;
+}
+
+/**
+ * @brief Advance to the next live element, skipping tombstones
+ * @param iter Iterator
+ * @return true if iter->element now points at a live element
+ */
+static inline bool ring_pool_iter_next(ring_pool_iter_t *iter) {
+    ring_pool_t *pool = iter->pool;
+
+    while (iter->segment < pool->segment_count) {
+        const ring_segment_t *segment = &pool->segments[iter->segment];
+
+        // Elements released mid-iteration may have moved the head past our position
+        if (iter->next < segment->head) {
+            iter->next = segment->head;
+        }
+
+        while (iter->next < segment->tail) {
+            size_t slot = iter->next++ & pool->mask;
+            if (segment->alive[slot]) {
+                iter->index = (iter->segment << pool->segment_shift) | slot;
+                iter->element = segment->elements + slot * pool->stride;
+                return true;
+            }
+        }
+
+        iter->segment++;
+        iter->next = 0;
+    }
+
+    iter->element = NULL;
+    return false;
+}
+
+/**
+ * @brief Whether the current element is the oldest one its segment still holds
+ *
+ * Expired elements can only be reclaimed from the head, so a sweep releases
+ * the current element when this is true; once it meets a live element, the
+ * rest of that segment is newer and can be skipped.
+ *
+ * @param iter Iterator positioned on an element
+ * @return true if the element sits at the head of its segment
+ */
+static inline bool ring_pool_iter_at_head(const ring_pool_iter_t *iter) {
+    return iter->next - 1 == iter->pool->segments[iter->segment].head;
+}
+
+/**
+ * @brief Leave the rest of the current segment unvisited
+ * @param iter Iterator (the next call continues with the oldest element of the next segment)
+ */
+static inline void ring_pool_iter_skip_segment(ring_pool_iter_t *iter) {
+    iter->next = iter->pool->segments[iter->segment].tail;
+}
+
+/**
+ * @brief Release the element the iterator currently points at
+ * @param iter Iterator (stays valid, the next call continues after the element)
+ */
+static inline void ring_pool_iter_release(ring_pool_iter_t *iter) { ring_pool_release(iter->pool, iter->index); }
+
+#endif // GAME_SRC_MEMORY_RING_POOL_H_
@@ -0,0 +1,112 @@
+/**
+ * @file kinematics.h
+ * @brief Analytic constant-velocity motion
+ *
+ * Entities that move in a straight line at constant speed between discrete
+ * events (wrap, bounce, land, hit) store their motion as an origin, a
+ * velocity per simulation tick and the tick the motion started. Position is
+ * evaluated on demand instead of being integrated every tick, and the tick
+ * of the next boundary crossing can be computed up front and queued as a
+ * motion event.
+ */
+
+#ifndef GAME_SRC_PHYSICS_KINEMATICS_H_
+#define GAME_SRC_PHYSICS_KINEMATICS_H_
+
+#include "sim_scalar.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Simulation tick counter (one tick per gameplay update)
+typedef uint32_t sim_tick_t;
+
+// Tick value for events that never happen
+#define SIM_TICK_NEVER UINT32_MAX
+
+/**
+ * One-dimensional constant-velocity motion
+ */
+typedef struct {
+    sim_scalar_t origin;   // Position at start_tick
+    sim_scalar_t velocity; // Displacement per tick
+    sim_tick_t start_tick; // Tick the motion was (re)based at
+} linear_motion_t;
+
+/**
+ * @brief Build a motion starting at the given tick
+ * @param origin Position at tick
+ * @param velocity Displacement per tick
+ * @param tick Start tick
+ * @return Motion
+ */
+static inline linear_motion_t linear_motion(sim_scalar_t origin, sim_scalar_t velocity, sim_tick_t tick) {
+    linear_motion_t motion = {origin, velocity, tick};
+    return motion;
+}
+
+/**
+ * @brief Evaluate the position at a tick
+ * @param motion Motion
+ * @param tick Tick to evaluate at (not before start_tick)
+ * @return Position
+ */
+static inline sim_scalar_t motion_position(const linear_motion_t *motion, sim_tick_t tick) {
+    return motion->origin + sim_scale(motion->velocity, tick - motion->start_tick);
+}
+
+/**
+ * @brief Ticks needed to cover a distance at a speed
+ * @param distance Distance still to travel (negative if already past)
+ * @param speed Positive displacement per tick
+ * @param inclusive true to count landing exactly on the distance, false to require going past it
+ * @return Tick count, at least 1
+ */
+static inline sim_tick_t motion_ticks_to_cover(sim_scalar_t distance, sim_scalar_t speed, bool inclusive) {
+    if (distance < 0) {
+        return 1;
+    }
+
+#ifdef GAME_FIXED_POINT
+    // Exact integer division, identical on every build
+    sim_scalar_t ticks = inclusive ? (distance + speed - 1) / speed : distance / speed + 1;
+#else
+    float ticks = inclusive ? ceilf(distance / speed) : floorf(distance / speed) + 1.0f;
+#endif
+    return ticks < 1 ? 1 : (sim_tick_t)ticks;
+}
+
+/**
+ * @brief First tick at which the position is strictly past a limit in the direction of travel
+ * @param motion Motion
+ * @param limit Boundary position
+ * @return Absolute tick (at least start_tick + 1), SIM_TICK_NEVER if the motion never gets there
+ */
+static inline sim_tick_t motion_tick_beyond(const linear_motion_t *motion, sim_scalar_t limit) {
+    if (motion->velocity == 0) {
+        return SIM_TICK_NEVER;
+    }
+
+    // Same strict test a per-tick step would apply after moving
+    sim_scalar_t distance = motion->velocity > 0 ? limit - motion->origin : motion->origin - limit;
+    sim_scalar_t speed = motion->velocity > 0 ? motion->velocity : -motion->velocity;
+    return motion->start_tick + motion_ticks_to_cover(distance, speed, false);
+}
+
+/**
+ * @brief First tick at which the position reaches a limit in the direction of travel
+ * @param motion Motion
+ * @param limit Boundary position
+ * @return Absolute tick (at least start_tick + 1), SIM_TICK_NEVER if the motion never gets there
+ */
+static inline sim_tick_t motion_tick_reaching(const linear_motion_t *motion, sim_scalar_t limit) {
+    if (motion->velocity == 0) {
+        return SIM_TICK_NEVER;
+    }
+
+    sim_scalar_t distance = motion->velocity > 0 ? limit - motion->origin : motion->origin - limit;
+    sim_scalar_t speed = motion->velocity > 0 ? motion->velocity : -motion->velocity;
+    return motion->start_tick + motion_ticks_to_cover(distance, speed, true);
+}
+
+#endif // GAME_SRC_PHYSICS_KINEMATICS_H_
@@ -0,0 +1,36 @@
+/**
+ * @file motion_dispatch.c
+ * @brief Motion event routing implementation
+ */
+
+#include "motion_dispatch.h"
+
+#include "brick.h"
+#include "crab.h"
+#include "jellyfish.h"
+#include "popcorn.h"
+
+void motion_events_dispatch(motion_event_queue_ptr events, const motion_dispatch_t *dispatch, sim_tick_t tick,
+                            timestamp_ms_t current_time) {
+    // Only movers with an event due this tick are touched; everything else is evaluated on demand
+    motion_event_t event;
+    while (motion_event_pop_due(events, tick, &event)) {
+        switch (event.type) {
+        case MOTION_EVENT_CRAB_WRAP:
+            crab_handle_wrap((crab_ptr)event.entity, events, event.id, dispatch->animations,
+                             dispatch->crabs_with_bricks, dispatch->logical_width, tick, current_time);
+            break;
+        case MOTION_EVENT_POPCORN_EXIT:
+            popcorn_handle_exit((popcorn_ptr)event.entity, event.id);
+            break;
+        case MOTION_EVENT_BRICK_LAND:
+            brick_handle_land((brick_ptr)event.entity, event.id, dispatch->timers, tick, dispatch->lake_start_y,
+                              current_time);
+            break;
+        case MOTION_EVENT_JELLYFISH_BOUNCE:
+            jellyfish_formation_handle_bounce((jellyfish_formation_ptr)event.entity, events, event.id,
+                                              dispatch->logical_width, tick);
+            break;
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/**
+ * @file motion_dispatch.h
+ * @brief Routes due motion events to the entity that predicted them
+ *
+ * Shared by the playing stage and the headless state-hash check so both
+ * run exactly the same event handling.
+ */
+
+#ifndef GAME_SRC_PHYSICS_MOTION_DISPATCH_H_
+#define GAME_SRC_PHYSICS_MOTION_DISPATCH_H_
+
+#include "motion_events.h"
+#include "sprite_animation.h"
+#include "timer_wheel.h"
+#include "types.h"
+
+/**
+ * Game state the event handlers act on
+ */
+typedef struct {
+    timer_wheel_ptr timers;                 // Landed brick timeouts are armed here
+    sprite_animation_system_ptr animations; // Crabs switch to the carry clip on pickup
+    int *crabs_with_bricks;                 // Running count updated on pickup
+    int logical_width;                      // Screen width (crab wrap, jellyfish bounce)
+    int lake_start_y;                       // Lake surface (brick landing)
+} motion_dispatch_t;
+
+// Pointer typedef for motion dispatch context
+typedef motion_dispatch_t *motion_dispatch_ptr;
+
+/**
+ * @brief Handle every event due at or before the current tick, in tick order
+ * @param events Motion event queue
+ * @param dispatch Game state the handlers act on
+ * @param tick Current simulation tick
+ * @param current_time Current game time
+ */
+void motion_events_dispatch(motion_event_queue_ptr events, const motion_dispatch_t *dispatch, sim_tick_t tick,
+                            timestamp_ms_t current_time);
+
+#endif // GAME_SRC_PHYSICS_MOTION_DISPATCH_H_
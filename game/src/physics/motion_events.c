@@ -0,0 +1,118 @@
+/**
+ * @file motion_events.c
+ * @brief Priority queue of predicted motion events implementation
+ */
+
+#include "motion_events.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Strict ordering: earlier tick first, then scheduling order for determinism
+static inline bool event_before(const motion_event_t *a, const motion_event_t *b) {
+    return a->tick < b->tick || (a->tick == b->tick && a->id < b->id);
+}
+
+static void sift_up(motion_event_t *heap, size_t position) {
+    motion_event_t event = heap[position];
+    while (position > 0) {
+        size_t parent = (position - 1) / 2;
+        if (!event_before(&event, &heap[parent])) {
+            break;
+        }
+        heap[position] = heap[parent];
+        position = parent;
+    }
+    heap[position] = event;
+}
+
+static void sift_down(motion_event_t *heap, size_t count, size_t position) {
+    motion_event_t event = heap[position];
+    for (;;) {
+        size_t child = 2 * position + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && event_before(&heap[child + 1], &heap[child])) {
+            child++;
+        }
+        if (!event_before(&heap[child], &event)) {
+            break;
+        }
+        heap[position] = heap[child];
+        position = child;
+    }
+    heap[position] = event;
+}
+
+bool motion_event_queue_init(motion_event_queue_ptr queue, size_t capacity) {
+    memset(queue, 0, sizeof(*queue));
+
+    if (capacity == 0) {
+        return false;
+    }
+
+    queue->heap = malloc(capacity * sizeof(motion_event_t));
+    if (!queue->heap) {
+        return false;
+    }
+
+    queue->capacity = capacity;
+    queue->next_id = MOTION_EVENT_NONE + 1;
+    return true;
+}
+
+motion_event_id_t motion_event_schedule(motion_event_queue_ptr queue, sim_tick_t tick, motion_event_type_t type,
+                                        void *entity) {
+    if (!queue->heap || tick == SIM_TICK_NEVER) {
+        return MOTION_EVENT_NONE;
+    }
+
+    if (queue->count == queue->capacity) {
+        // Nothing points into the heap, so it can move
+        motion_event_t *grown = realloc(queue->heap, queue->capacity * 2 * sizeof(motion_event_t));
+        if (!grown) {
+            return MOTION_EVENT_NONE;
+        }
+        queue->heap = grown;
+        queue->capacity *= 2;
+    }
+
+    motion_event_id_t id = queue->next_id++;
+    if (queue->next_id == MOTION_EVENT_NONE) {
+        queue->next_id++; // Skip the reserved id on wrap-around
+    }
+
+    motion_event_t *slot = &queue->heap[queue->count];
+    slot->tick = tick;
+    slot->id = id;
+    slot->type = type;
+    slot->entity = entity;
+    sift_up(queue->heap, queue->count++);
+
+    return id;
+}
+
+bool motion_event_pop_due(motion_event_queue_ptr queue, sim_tick_t tick, motion_event_t *event) {
+    if (queue->count == 0 || queue->heap[0].tick > tick) {
+        return false;
+    }
+
+    *event = queue->heap[0];
+    queue->heap[0] = queue->heap[--queue->count];
+    if (queue->count > 0) {
+        sift_down(queue->heap, queue->count, 0);
+    }
+    return true;
+}
+
+sim_tick_t motion_event_next_tick(const motion_event_queue_t *queue) {
+    return queue->count > 0 ? queue->heap[0].tick : SIM_TICK_NEVER;
+}
+
+void motion_event_queue_clear(motion_event_queue_ptr queue) { queue->count = 0; }
+
+void motion_event_queue_destroy(motion_event_queue_ptr queue) {
+    free(queue->heap);
+    memset(queue, 0, sizeof(*queue));
+}
@@ -0,0 +1,110 @@
+/**
+ * @file motion_events.h
+ * @brief Priority queue of predicted motion events
+ *
+ * Every analytic mover queues the tick of its next discrete event (crab
+ * wrap, popcorn exit, brick landing, jellyfish bounce). The gameplay tick
+ * pops only the events that are due, so movers in between events cost
+ * nothing, and motion_event_next_tick() tells a headless fast-forward how
+ * far it can jump without missing anything.
+ *
+ * Events are invalidated lazily: each mover remembers the id of the event
+ * it is waiting for, and a popped event whose id no longer matches (the
+ * mover changed course, died or its slot was reused) is simply ignored.
+ */
+
+#ifndef GAME_SRC_PHYSICS_MOTION_EVENTS_H_
+#define GAME_SRC_PHYSICS_MOTION_EVENTS_H_
+
+#include "kinematics.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Id value that never refers to a queued event
+#define MOTION_EVENT_NONE 0
+
+/**
+ * Motion event kinds
+ */
+typedef enum {
+    MOTION_EVENT_CRAB_WRAP,       // Crab left the screen and re-enters at the other edge
+    MOTION_EVENT_POPCORN_EXIT,    // Popcorn left the screen
+    MOTION_EVENT_BRICK_LAND,      // Falling brick reached the lake surface
+    MOTION_EVENT_JELLYFISH_BOUNCE // Jellyfish formation hit a screen edge
+} motion_event_type_t;
+
+// Unique event identifier (never reused within a queue's lifetime)
+typedef uint32_t motion_event_id_t;
+
+/**
+ * Predicted motion event
+ */
+typedef struct {
+    sim_tick_t tick;          // Tick the event happens at
+    motion_event_id_t id;     // Matches the mover's pending id while still valid
+    motion_event_type_t type; // What happens
+    void *entity;             // Mover the event belongs to
+} motion_event_t;
+
+/**
+ * Motion event queue (binary min-heap ordered by tick, then id)
+ */
+typedef struct {
+    motion_event_t *heap;
+    size_t count;
+    size_t capacity;
+    motion_event_id_t next_id;
+} motion_event_queue_t;
+
+// Pointer typedef for motion event queue
+typedef motion_event_queue_t *motion_event_queue_ptr;
+
+/**
+ * @brief Initialize an empty queue
+ * @param queue Queue to initialize
+ * @param capacity Initial heap capacity (the heap grows when full)
+ * @return true if successful
+ */
+bool motion_event_queue_init(motion_event_queue_ptr queue, size_t capacity);
+
+/**
+ * @brief Queue an event
+ * @param queue Motion event queue
+ * @param tick Tick the event happens at (SIM_TICK_NEVER queues nothing)
+ * @param type Event kind
+ * @param entity Mover the event belongs to
+ * @return Event id for the mover to remember, MOTION_EVENT_NONE if nothing was queued
+ */
+motion_event_id_t motion_event_schedule(motion_event_queue_ptr queue, sim_tick_t tick, motion_event_type_t type,
+                                        void *entity);
+
+/**
+ * @brief Pop the earliest event if it is due
+ * @param queue Motion event queue
+ * @param tick Current tick
+ * @param event Output event
+ * @return true if an event due at or before tick was popped
+ */
+bool motion_event_pop_due(motion_event_queue_ptr queue, sim_tick_t tick, motion_event_t *event);
+
+/**
+ * @brief Tick of the earliest queued event (valid or stale)
+ * @param queue Motion event queue
+ * @return Tick, SIM_TICK_NEVER if the queue is empty
+ */
+sim_tick_t motion_event_next_tick(const motion_event_queue_t *queue);
+
+/**
+ * @brief Drop every queued event
+ * @param queue Motion event queue
+ */
+void motion_event_queue_clear(motion_event_queue_ptr queue);
+
+/**
+ * @brief Free the memory owned by the queue
+ * @param queue Motion event queue
+ */
+void motion_event_queue_destroy(motion_event_queue_ptr queue);
+
+#endif // GAME_SRC_PHYSICS_MOTION_EVENTS_H_
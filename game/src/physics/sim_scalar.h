@@ -0,0 +1,74 @@
+/**
+ * @file sim_scalar.h
+ * @brief Scalar type for simulation positions and velocities
+ *
+ * The default build keeps positions as floats. The deterministic profile
+ * (GAME_FIXED_POINT, see `make PROFILE=deterministic`) switches them to
+ * Q16.16 fixed point so the simulation produces bit-identical state across
+ * compilers, optimization levels and CPUs. Simulation code only touches
+ * positions through this header, so both profiles share one code path.
+ */
+
+#ifndef GAME_SRC_PHYSICS_SIM_SCALAR_H_
+#define GAME_SRC_PHYSICS_SIM_SCALAR_H_
+
+#include <stdint.h>
+
+#ifdef GAME_FIXED_POINT
+
+// Q16.16 fixed point
+typedef int32_t sim_scalar_t;
+
+#define SIM_FRACTION_BITS 16
+#define SIM_ONE ((sim_scalar_t)1 << SIM_FRACTION_BITS)
+
+// Conversions (float conversion truncates towards zero, so feed it constants or deterministic values)
+#define SIM_FROM_INT(value) ((sim_scalar_t)(value) * SIM_ONE)
+#define SIM_FROM_FLOAT(value) ((sim_scalar_t)((value) * (float)SIM_ONE))
+#define SIM_TO_FLOAT(value) ((float)(value) / (float)SIM_ONE)
+#define SIM_TO_INT(value) sim_floor_to_int(value)
+
+// Round towards negative infinity without relying on arithmetic right shift
+static inline int sim_floor_to_int(sim_scalar_t value) {
+    return value >= 0 ? (int)(value / SIM_ONE) : -(int)((-(int64_t)value + SIM_ONE - 1) / SIM_ONE);
+}
+
+/**
+ * @brief Scale a per-tick velocity by a tick count
+ * @param velocity Displacement per tick
+ * @param ticks Number of ticks
+ * @return Total displacement
+ */
+static inline sim_scalar_t sim_scale(sim_scalar_t velocity, uint32_t ticks) {
+    return (sim_scalar_t)((int64_t)velocity * (int64_t)ticks);
+}
+
+/**
+ * @brief Map a 32-bit random value onto [0, range)
+ * @param random Uniform random bits
+ * @param range Upper bound (non-negative)
+ * @return Value in [0, range)
+ */
+static inline sim_scalar_t sim_random_below(uint32_t random, sim_scalar_t range) {
+    return (sim_scalar_t)(((uint64_t)random * (uint64_t)range) >> 32);
+}
+
+#else
+
+// Plain floats
+typedef float sim_scalar_t;
+
+#define SIM_FROM_INT(value) ((float)(value))
+#define SIM_FROM_FLOAT(value) ((float)(value))
+#define SIM_TO_FLOAT(value) (value)
+#define SIM_TO_INT(value) ((int)(value))
+
+static inline sim_scalar_t sim_scale(sim_scalar_t velocity, uint32_t ticks) { return velocity * (float)ticks; }
+
+static inline sim_scalar_t sim_random_below(uint32_t random, sim_scalar_t range) {
+    return (float)random * (range / 4294967296.0f);
+}
+
+#endif // GAME_FIXED_POINT
+
+#endif // GAME_SRC_PHYSICS_SIM_SCALAR_H_
@@ -0,0 +1,68 @@
+/**
+ * @file state_hash.c
+ * @brief Simulation state hash implementation
+ */
+
+#include "state_hash.h"
+
+#include "brick.h"
+#include "crab.h"
+#include "popcorn.h"
+
+static inline state_hash_t state_hash_flags(state_hash_t hash, bool a, bool b, bool c, bool d) {
+    return state_hash_u32(hash, (uint32_t)a | (uint32_t)b << 1 | (uint32_t)c << 2 | (uint32_t)d << 3);
+}
+
+state_hash_t state_hash_duck(state_hash_t hash, const duck_t *duck) {
+    hash = state_hash_scalar(hash, duck->x);
+    hash = state_hash_scalar(hash, duck->y);
+    hash = state_hash_scalar(hash, duck->vx);
+    return state_hash_flags(hash, duck->facing_right, duck->shooting, duck->dead, false);
+}
+
+state_hash_t state_hash_crabs(state_hash_t hash, entity_pool_t *pool, sim_tick_t tick) {
+    entity_pool_iter_t iter = entity_pool_iter(pool);
+    while (entity_pool_iter_next(&iter)) {
+        const crab_t *crab = (const crab_t *)iter.element;
+        hash = state_hash_scalar(hash, crab_x(crab, tick));
+        hash = state_hash_scalar(hash, crab->y);
+        hash = state_hash_scalar(hash, crab->motion.velocity);
+        hash = state_hash_flags(hash, crab->alive, crab->has_brick, crab->dropping, crab->drop_ready);
+    }
+    return state_hash_u32(hash, (uint32_t)pool->active_count);
+}
+
+state_hash_t state_hash_popcorn(state_hash_t hash, ring_pool_t *pool, sim_tick_t tick) {
+    ring_pool_iter_t iter = ring_pool_iter(pool);
+    while (ring_pool_iter_next(&iter)) {
+        const popcorn_t *popcorn = (const popcorn_t *)iter.element;
+        if (!popcorn->active) {
+            continue; // Spent popcorn waiting for the ring head is not state
+        }
+        hash = state_hash_scalar(hash, popcorn->x);
+        hash = state_hash_scalar(hash, popcorn_y(popcorn, tick));
+        hash = state_hash_flags(hash, popcorn->reflected, false, false, false);
+    }
+    return hash;
+}
+
+state_hash_t state_hash_bricks(state_hash_t hash, ring_pool_t *pool, sim_tick_t tick) {
+    ring_pool_iter_t iter = ring_pool_iter(pool);
+    while (ring_pool_iter_next(&iter)) {
+        const brick_t *brick = (const brick_t *)iter.element;
+        if (!brick->active) {
+            continue;
+        }
+        hash = state_hash_scalar(hash, brick->x);
+        hash = state_hash_scalar(hash, brick_y(brick, tick));
+        hash = state_hash_flags(hash, brick->landed, false, false, false);
+    }
+    return hash;
+}
+
+state_hash_t state_hash_jellyfish(state_hash_t hash, const jellyfish_formation_t *formation) {
+    hash = state_hash_scalar(hash, formation->x);
+    hash = state_hash_scalar(hash, formation->y);
+    hash = state_hash_scalar(hash, formation->motion.velocity);
+    return state_hash_flags(hash, formation->moving_right, false, false, false);
+}
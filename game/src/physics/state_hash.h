@@ -0,0 +1,99 @@
+/**
+ * @file state_hash.h
+ * @brief Hash of the simulation state for determinism checks
+ *
+ * FNV-1a over the raw bits of every simulated position, velocity and flag,
+ * in pool order. Two builds that simulate identically produce identical
+ * hashes; in the deterministic profile this holds across compilers,
+ * optimization levels and CPUs.
+ */
+
+#ifndef GAME_SRC_PHYSICS_STATE_HASH_H_
+#define GAME_SRC_PHYSICS_STATE_HASH_H_
+
+#include "duck.h"
+#include "entity_pool.h"
+#include "jellyfish.h"
+#include "kinematics.h"
+#include "ring_pool.h"
+#include "sim_scalar.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Running state hash
+typedef uint64_t state_hash_t;
+
+// Initial hash value (FNV-1a 64-bit offset basis)
+#define STATE_HASH_SEED 0xcbf29ce484222325ULL
+
+/**
+ * @brief Mix a 32-bit value into the hash, byte by byte in little-endian order
+ * @param hash Running hash
+ * @param value Value to mix in
+ * @return Updated hash
+ */
+static inline state_hash_t state_hash_u32(state_hash_t hash, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        hash ^= (value >> (8 * i)) & 0xFFU;
+        hash *= 0x100000001b3ULL; // FNV-1a 64-bit prime
+    }
+    return hash;
+}
+
+/**
+ * @brief Mix the exact bits of a simulation scalar into the hash
+ * @param hash Running hash
+ * @param value Scalar to mix in
+ * @return Updated hash
+ */
+static inline state_hash_t state_hash_scalar(state_hash_t hash, sim_scalar_t value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return state_hash_u32(hash, bits);
+}
+
+/**
+ * @brief Mix the duck's position and state into the hash
+ * @param hash Running hash
+ * @param duck Duck
+ * @return Updated hash
+ */
+state_hash_t state_hash_duck(state_hash_t hash, const duck_t *duck);
+
+/**
+ * @brief Mix every live crab into the hash
+ * @param hash Running hash
+ * @param pool Crab pool
+ * @param tick Simulation tick positions are evaluated at
+ * @return Updated hash
+ */
+state_hash_t state_hash_crabs(state_hash_t hash, entity_pool_t *pool, sim_tick_t tick);
+
+/**
+ * @brief Mix every popcorn in flight into the hash
+ * @param hash Running hash
+ * @param pool Popcorn ring
+ * @param tick Simulation tick positions are evaluated at
+ * @return Updated hash
+ */
+state_hash_t state_hash_popcorn(state_hash_t hash, ring_pool_t *pool, sim_tick_t tick);
+
+/**
+ * @brief Mix every falling or landed brick into the hash
+ * @param hash Running hash
+ * @param pool Brick ring
+ * @param tick Simulation tick positions are evaluated at
+ * @return Updated hash
+ */
+state_hash_t state_hash_bricks(state_hash_t hash, ring_pool_t *pool, sim_tick_t tick);
+
+/**
+ * @brief Mix the jellyfish formation into the hash
+ * @param hash Running hash
+ * @param formation Jellyfish formation (updated for the current tick)
+ * @return Updated hash
+ */
+state_hash_t state_hash_jellyfish(state_hash_t hash, const jellyfish_formation_t *formation);
+
+#endif // GAME_SRC_PHYSICS_STATE_HASH_H_
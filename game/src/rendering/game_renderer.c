@@ -11,205 +11,300 @@
 #include "duck.h"
 #include "frame.h"
 #include "jellyfish.h"
+#include "lake_layer.h"
+#include "particle_system.h"
 #include "popcorn.h"
+#include "render_layer.h"
+#include "render_snapshot.h"
+#include "soft_raster.h"
+#include "software_renderer.h"
+#include "sprite_animation.h"
 #include "sprite_atlas.h"
+#include "sprite_batch.h"
+#include "text_cache.h"
 #include <stdio.h>
 
+// Every sprite goes through here, to the GPU sprite batch or to the software framebuffer
+static void draw_sprite(game_ptr game, const sprite_rect_t *sprite, int x, int y, int scale, flip_t flip) {
+    // x and y place the untrimmed sprite; a mirrored sprite has its trim on the other side
+    int offset_x = flip == FLIP_HORIZONTAL ? sprite->source_w - sprite->offset_x - sprite->w : sprite->offset_x;
+    int offset_y = flip == FLIP_VERTICAL ? sprite->source_h - sprite->offset_y - sprite->h : sprite->offset_y;
+    x += offset_x * scale;
+    y += offset_y * scale;
+
+    software_renderer_ptr software = &game->software_renderer;
+    if (software->enabled) {
+        soft_blit(&software->framebuffer, &software->sprite_sheet, sprite, x, y, scale, flip);
+    } else {
+        sprite_batch_draw(&game->sprite_batch, &game->sprite_sheet, sprite, x, y, sprite->w * scale, sprite->h * scale,
+                          flip);
+    }
+}
+
+static bool sprites_loaded(game_ptr game) {
+    // The sheet draw_sprite blits from: an offscreen export has no GPU copy at all
+    return game->software_renderer.enabled ? game->software_renderer.sprite_sheet.pixels != NULL
+                                           : game->sprite_sheet.texture != NULL;
+}
+
 static void render_lake(game_ptr game) {
-    const int lake_height = LAKE_HEIGHT;
-    const int lake_start_y = LAKE_START_Y;
+    // One stretched copy of the gradient baked at load time
+    lake_layer_render(&game->lake, &game->graphics_context, 0, LAKE_START_Y);
+}
 
-    // Draw horizontal lines with gradient from cyan to dark blue using engine
-    for (int y = 0; y < lake_height; y++) {
-        // Gradient from cyan (0, 255, 255) to dark blue (0, 0, 100)
-        float t = (float)y / lake_height;
-        int green_value = (int)(255 * (1.0f - t)); // From 255 to 0
-        int blue_value = (int)(255 - t * 155);     // From 255 to 100
-        color_t line_color = COLOR(0, green_value, blue_value);
-        draw_line(&game->graphics_context, 0, lake_start_y + y, LOGICAL_WIDTH - 1, lake_start_y + y, line_color);
+static void render_lake_software(game_ptr game) {
+    // One row fill per line of the same gradient the GPU texture is baked from
+    const lake_layer_t *lake = &game->lake;
+    for (int y = 0; y < lake->height; y++) {
+        color_t line_color = lake->gradient((float)y / lake->height);
+        soft_fill_rect(&game->software_renderer.framebuffer, 0, LAKE_START_Y + y, lake->width, 1,
+                       soft_pixel(line_color));
     }
 }
 
-static void render_duck(game_ptr game) {
-    if (!game->sprite_sheet.texture)
-        return;
-
+static void capture_duck(game_ptr game, render_snapshot_ptr snapshot) {
     const int duck_scale = 2; // 2x scale
-    const sprite_rect_t *sprite;
-
-    if (game->duck.dead) {
-        sprite = &SPRITE_DUCK_DEAD;
-        rect_t src_rect = make_rect(sprite->x, sprite->y, sprite->w, sprite->h);
-        render_sprite_scaled(&game->graphics_context, &game->sprite_sheet, &src_rect, (int)game->duck.x,
-                             (int)game->duck.y, duck_scale);
-    } else if (game->duck.shooting) {
-        sprite = &SPRITE_DUCK_SHOOTING;
-        const int normal_sprite_height = SPRITE_DUCK_NORMAL.h;
-        rect_t src_rect = make_rect(sprite->x, sprite->y, sprite->w, sprite->h);
-
-        // Adjust y position to align base with normal sprite
-        int y_offset = (sprite->h - normal_sprite_height) * duck_scale;
-        rect_t dst_rect =
-            make_rect((int)game->duck.x, (int)game->duck.y - y_offset, sprite->w * duck_scale, sprite->h * duck_scale);
-
-        // Flip to left when facing left (sprite shows shooting right)
-        flip_t flip = game->duck.facing_right ? FLIP_NONE : FLIP_HORIZONTAL;
-        render_sprite_flipped(&game->graphics_context, &game->sprite_sheet, &src_rect, &dst_rect, flip);
-    } else {
-        sprite = &SPRITE_DUCK_NORMAL;
-        rect_t src_rect = make_rect(sprite->x, sprite->y, sprite->w, sprite->h);
-        rect_t dst_rect =
-            make_rect((int)game->duck.x, (int)game->duck.y, sprite->w * duck_scale, sprite->h * duck_scale);
 
-        // Flip to right when facing right (sprite points left)
-        flip_t flip = game->duck.facing_right ? FLIP_HORIZONTAL : FLIP_NONE;
-        render_sprite_flipped(&game->graphics_context, &game->sprite_sheet, &src_rect, &dst_rect, flip);
+    // The pose (idle, shooting, dead) is whatever clip the duck's animation is playing
+    const sprite_rect_t *sprite = sprite_animation_frame(&game->animations, game->duck.animation);
+    const animation_clip_t *clip = sprite_animation_clip(&game->animations, game->duck.animation);
+
+    // Adjust y position to align base with the clip's baseline sprite
+    int y_offset = clip->baseline_height > 0 ? (sprite->source_h - clip->baseline_height) * duck_scale : 0;
+
+    // Mirror frames that face away from the duck's direction
+    flip_t flip = FLIP_NONE;
+    if (clip->facing != SPRITE_FACING_NONE && game->duck.facing_right != (clip->facing == SPRITE_FACING_RIGHT)) {
+        flip = FLIP_HORIZONTAL;
     }
+    render_snapshot_add_sprite(snapshot, sprite, SIM_TO_INT(game->duck.x), SIM_TO_INT(game->duck.y) - y_offset,
+                               duck_scale, flip);
 }
 
-static void render_popcorn(game_ptr game) {
-    if (!game->sprite_sheet.texture)
-        return;
-
+static void capture_popcorn(game_ptr game, render_snapshot_ptr snapshot) {
     const int popcorn_scale = 1; // 1x scale
-    rect_t src_rect = make_rect(SPRITE_POPCORN.x, SPRITE_POPCORN.y, SPRITE_POPCORN.w, SPRITE_POPCORN.h);
 
-    for (size_t i = 0; i < game->popcorn_pool.capacity; i++) {
-        if (!pool_is_active(&game->popcorn_pool, i))
-            continue;
+    // The fused collision pass has already queued this frame's popcorn; otherwise walk the ring once more
+    popcorn_draw_list_ptr draws = &game->popcorn_draws;
+    if (!game->fused_popcorn_pass) {
+        popcorn_draw_list_build(draws, &game->popcorn_pool, game->sim_tick);
+    }
 
-        popcorn_ptr popcorn = (popcorn_ptr)pool_get_at(&game->popcorn_pool, i);
-        if (popcorn && popcorn->active) {
-            render_sprite_scaled(&game->graphics_context, &game->sprite_sheet, &src_rect, (int)popcorn->x,
-                                 (int)popcorn->y, popcorn_scale);
-        }
+    for (size_t i = 0; i < draws->count; i++) {
+        render_snapshot_add_sprite(snapshot, &SPRITE_POPCORN, draws->items[i].x, draws->items[i].y, popcorn_scale,
+                                   FLIP_NONE);
     }
 }
 
-static void render_crabs(game_ptr game) {
-    if (!game->sprite_sheet.texture)
-        return;
-
+static void capture_crabs(game_ptr game, render_snapshot_ptr snapshot) {
     const int crab_scale = 2; // 2x scale
 
-    for (size_t i = 0; i < game->crab_pool.capacity; i++) {
-        if (!pool_is_active(&game->crab_pool, i))
-            continue;
-
-        crab_ptr crab = (crab_ptr)pool_get_at(&game->crab_pool, i);
-        if (!crab || !crab->alive)
+    entity_pool_iter_t iter = entity_pool_iter(&game->crab_pool);
+    while (entity_pool_iter_next(&iter)) {
+        crab_ptr crab = (crab_ptr)iter.element;
+        if (!crab->alive)
             continue;
 
-        const sprite_rect_t *sprite;
-
-        if (crab->dropping) {
-            sprite = &SPRITE_CRAB_DROPPING;
-        } else if (crab->has_brick) {
-            sprite = &SPRITE_CRAB_WITH_BRICK;
-        } else {
-            sprite = &SPRITE_CRAB_NORMAL;
-        }
-
-        rect_t src_rect = make_rect(sprite->x, sprite->y, sprite->w, sprite->h);
-        render_sprite_scaled(&game->graphics_context, &game->sprite_sheet, &src_rect, (int)crab->x, (int)crab->y,
-                             crab_scale);
+        const sprite_rect_t *sprite = sprite_animation_frame(&game->animations, crab->animation);
+        render_snapshot_add_sprite(snapshot, sprite, SIM_TO_INT(crab_x(crab, game->sim_tick)), SIM_TO_INT(crab->y),
+                                   crab_scale, FLIP_NONE);
     }
 }
 
-static void render_jellyfish(game_ptr game) {
-    if (!game->sprite_sheet.texture)
-        return;
-
+static void capture_jellyfish(game_ptr game, render_snapshot_ptr snapshot) {
     const int jellyfish_scale = 2; // 2x scale
 
-    for (size_t i = 0; i < game->jellyfish_pool.capacity; i++) {
-        if (!pool_is_active(&game->jellyfish_pool, i))
-            continue;
+    const jellyfish_formation_t *formation = &game->jellyfish_formation;
 
-        jellyfish_ptr jellyfish = (jellyfish_ptr)pool_get_at(&game->jellyfish_pool, i);
-        if (!jellyfish)
-            continue;
-
-        const sprite_rect_t *sprite = &SPRITE_JELLYFISH_FRAMES[jellyfish->anim_frame];
-        rect_t src_rect = make_rect(sprite->x, sprite->y, sprite->w, sprite->h);
-        render_sprite_scaled(&game->graphics_context, &game->sprite_sheet, &src_rect, (int)jellyfish->x,
-                             (int)jellyfish->y, jellyfish_scale);
+    for (int i = 0; i < formation->member_count; i++) {
+        const sprite_rect_t *sprite = sprite_animation_frame(&game->animations, formation->member_animation[i]);
+        render_snapshot_add_sprite(snapshot, sprite, SIM_TO_INT(formation->member_x[i]),
+                                   SIM_TO_INT(formation->member_y[i]), jellyfish_scale, FLIP_NONE);
     }
 }
 
-static void render_bricks(game_ptr game) {
-    if (!game->sprite_sheet.texture)
-        return;
-
+static void capture_bricks(game_ptr game, render_snapshot_ptr snapshot) {
     const int brick_scale = 1; // 1x scale
-    rect_t src_rect = make_rect(SPRITE_BRICK.x, SPRITE_BRICK.y, SPRITE_BRICK.w, SPRITE_BRICK.h);
 
-    for (size_t i = 0; i < game->brick_pool.capacity; i++) {
-        if (!pool_is_active(&game->brick_pool, i))
-            continue;
-
-        brick_ptr brick = (brick_ptr)pool_get_at(&game->brick_pool, i);
-        if (brick && brick->active) {
-            render_sprite_scaled(&game->graphics_context, &game->sprite_sheet, &src_rect, (int)brick->x, (int)brick->y,
-                                 brick_scale);
+    ring_pool_iter_t iter = ring_pool_iter(&game->brick_pool);
+    while (ring_pool_iter_next(&iter)) {
+        brick_ptr brick = (brick_ptr)iter.element;
+        if (brick->active) {
+            render_snapshot_add_sprite(snapshot, &SPRITE_BRICK, SIM_TO_INT(brick->x),
+                                       SIM_TO_INT(brick_y(brick, game->sim_tick)), brick_scale, FLIP_NONE);
         }
     }
 }
 
-static void render_ui(game_ptr game) {
+static void render_lives(game_ptr game, int lives) {
     // Draw lives indicator (small ducks at bottom-left)
-    if (game->sprite_sheet.texture) {
+    if (sprites_loaded(game)) {
         const int life_duck_scale = 1; // 1x scale
         const int spacing = 5;
         const int bottom_margin = 5;
-        rect_t src_rect =
-            make_rect(SPRITE_DUCK_NORMAL.x, SPRITE_DUCK_NORMAL.y, SPRITE_DUCK_NORMAL.w, SPRITE_DUCK_NORMAL.h);
 
-        int y_pos = LOGICAL_HEIGHT - SPRITE_DUCK_NORMAL.h * life_duck_scale - bottom_margin;
+        int y_pos = LOGICAL_HEIGHT - SPRITE_DUCK_NORMAL.source_h * life_duck_scale - bottom_margin;
 
-        for (int i = 0; i < game->lives; i++) {
-            int x_pos = spacing + i * (SPRITE_DUCK_NORMAL.w * life_duck_scale + spacing);
-            rect_t dst_rect =
-                make_rect(x_pos, y_pos, SPRITE_DUCK_NORMAL.w * life_duck_scale, SPRITE_DUCK_NORMAL.h * life_duck_scale);
+        for (int i = 0; i < lives; i++) {
+            int x_pos = spacing + i * (SPRITE_DUCK_NORMAL.source_w * life_duck_scale + spacing);
 
             // Render facing right
-            render_sprite_flipped(&game->graphics_context, &game->sprite_sheet, &src_rect, &dst_rect, FLIP_HORIZONTAL);
+            draw_sprite(game, &SPRITE_DUCK_NORMAL, x_pos, y_pos, life_duck_scale, FLIP_HORIZONTAL);
         }
+        sprite_batch_flush(&game->sprite_batch);
     }
+}
 
+static void render_score(game_ptr game, int score) {
     // Draw score (right-aligned at bottom-right)
     if (game->font.texture.texture) {
         char score_text[32];
-        snprintf(score_text, sizeof(score_text), "%d", game->score);
+        snprintf(score_text, sizeof(score_text), "%d", score);
 
         const int bottom_margin = 5;
         const int right_margin = 5;
 
-        int text_width = get_bitmap_text_width(&game->font, score_text);
-        int x_pos = LOGICAL_WIDTH - text_width - right_margin;
+        // Measured and drawn glyph by glyph only when the string changes, then copied as one texture
+        cached_text_update(&game->score_text, &game->font, &game->graphics_context, score_text, FONT_COLOR_WHITE, 1);
+        int x_pos = LOGICAL_WIDTH - game->score_text.width - right_margin;
         int y_pos = LOGICAL_HEIGHT - 7 - bottom_margin;
 
-        render_bitmap_text(&game->font, &game->graphics_context, score_text, x_pos, y_pos, FONT_COLOR_WHITE);
+        cached_text_render(&game->score_text, &game->graphics_context, x_pos, y_pos);
     }
 }
 
-static void render_entities(game_ptr game) {
-    render_duck(game);
-    render_popcorn(game);
-    render_crabs(game);
-    render_jellyfish(game);
-    render_bricks(game);
+static void render_score_software(game_ptr game, int score) {
+    // Same place as render_score, with the glyphs blitted from the CPU copy of the font
+    char score_text[32];
+    snprintf(score_text, sizeof(score_text), "%d", score);
+
+    const int bottom_margin = 5;
+    const int right_margin = 5;
+
+    int x_pos = LOGICAL_WIDTH - software_renderer_text_width(score_text) - right_margin;
+    int y_pos = LOGICAL_HEIGHT - 7 - bottom_margin;
+
+    software_renderer_draw_text(&game->software_renderer, score_text, x_pos, y_pos);
+}
+
+static void render_ui(game_ptr game, const render_snapshot_t *snapshot) {
+    render_lives(game, snapshot->lives);
+    render_score(game, snapshot->score);
 }
 
-void render_game(game_ptr game) {
-    // Clear screen using engine
+static void render_entities(game_ptr game, render_snapshot_ptr snapshot) {
+    if (sprites_loaded(game)) {
+        for (size_t i = 0; i < snapshot->sprite_count; i++) {
+            const sprite_draw_t *draw = &snapshot->sprites[i];
+            draw_sprite(game, draw->sprite, draw->x, draw->y, draw->scale, draw->flip);
+        }
+    }
+
+    // All the sprites above go out as one geometry call, under the particles
+    sprite_batch_flush(&game->sprite_batch);
+
+    // Every live particle in one batched draw, on top of the sprites
+    if (game->software_renderer.enabled) {
+        particle_system_render_software(&snapshot->particles, &game->software_renderer.framebuffer);
+    } else {
+        particle_system_render(&snapshot->particles, &game->graphics_context);
+    }
+}
+
+static void refresh_static_layers(game_ptr game, const render_snapshot_t *snapshot) {
+    graphics_context_t *context = &game->graphics_context;
+
+    // After a reset the targets hold garbage, the score text included
+    if (render_layer_targets_lost(&game->render_target_resets, &game->drawn_target_resets)) {
+        render_layer_mark_dirty(&game->background_layer);
+        render_layer_mark_dirty(&game->hud_layer);
+        cached_text_invalidate(&game->score_text);
+    }
+
+    // A layer recreated at a new size comes back dirty
+    render_layer_resize(&game->background_layer, context, LOGICAL_WIDTH, LOGICAL_HEIGHT);
+    render_layer_resize(&game->hud_layer, context, LOGICAL_WIDTH, LOGICAL_HEIGHT);
+
+    if (snapshot->lives != game->hud_lives || snapshot->score != game->hud_score) {
+        render_layer_mark_dirty(&game->hud_layer);
+    }
+
+    if (render_layer_needs_redraw(&game->background_layer) && render_layer_begin(&game->background_layer, context)) {
+        clear_frame(context);
+        render_lake(game);
+        render_layer_end(&game->background_layer, context);
+    }
+
+    if (render_layer_needs_redraw(&game->hud_layer) && render_layer_begin(&game->hud_layer, context)) {
+        render_ui(game, snapshot);
+        render_layer_end(&game->hud_layer, context);
+        game->hud_lives = snapshot->lives;
+        game->hud_score = snapshot->score;
+    }
+}
+
+static void render_game_software(game_ptr game, render_snapshot_ptr snapshot) {
+    software_renderer_ptr software = &game->software_renderer;
+
+    // The whole frame is redrawn on the CPU; there are no cached GPU layers to reuse
+    soft_fill_rect(&software->framebuffer, 0, 0, LOGICAL_WIDTH, LOGICAL_HEIGHT, soft_pixel(COLOR(0, 0, 0)));
+    render_lake_software(game);
+    render_entities(game, snapshot);
+
+    render_lives(game, snapshot->lives);
+    render_score_software(game, snapshot->score);
+
+    software_renderer_present(software, &game->graphics_context);
+}
+
+void render_game_capture(game_ptr game) {
+    render_snapshot_ptr snapshot = render_snapshot_begin(&game->snapshots);
+
+    // Back to front, as they are drawn
+    capture_duck(game, snapshot);
+    capture_popcorn(game, snapshot);
+    capture_crabs(game, snapshot);
+    capture_jellyfish(game, snapshot);
+    capture_bricks(game, snapshot);
+    particle_system_copy_live(&snapshot->particles, &game->particles);
+
+    snapshot->lives = game->lives;
+    snapshot->score = game->score;
+    snapshot->tick = game->sim_tick;
+    render_snapshot_publish(&game->snapshots);
+}
+
+bool render_game_present(game_ptr game) {
+    render_snapshot_ptr snapshot = render_snapshot_latest(&game->snapshots);
+    if (!snapshot) {
+        return false;
+    }
+
+    if (game->software_renderer.enabled) {
+        render_game_software(game, snapshot);
+        return true;
+    }
+
+    // Sprites are queued and submitted per texture at each flush
+    sprite_batch_begin(&game->sprite_batch, &game->graphics_context);
+
+    // Redraw the background and HUD only if something on them changed
+    refresh_static_layers(game, snapshot);
+
+    // The clear only matters for the letterbox bars; the background layer covers the logical screen
     clear_frame(&game->graphics_context);
+    render_layer_composite(&game->background_layer, &game->graphics_context);
 
-    // Render game elements
-    render_lake(game);
-    render_entities(game);
-    render_ui(game);
+    // Only the moving entities are drawn from scratch every frame
+    render_entities(game, snapshot);
+    render_layer_composite(&game->hud_layer, &game->graphics_context);
 
     // Present the rendered frame using engine
     render_frame(&game->graphics_context);
+    return true;
+}
+
+void render_game(game_ptr game) {
+    render_game_capture(game);
+    render_game_present(game);
 }
@@ -7,9 +7,27 @@
 #define GAME_RENDERER_H
 
 #include "game.h"
+#include <stdbool.h>
 
 /**
- * @brief Render the complete game scene
+ * @brief Snapshot the renderable game state and publish it (simulation side)
+ * @param game Game state to capture
+ */
+void render_game_capture(game_ptr game);
+
+/**
+ * @brief Draw and present the latest published snapshot (render side)
+ *
+ * Touches only the snapshot and the render resources, never the simulation,
+ * so it can run on another thread than render_game_capture.
+ *
+ * @param game Game whose render resources are used
+ * @return true if a frame was presented, false if no snapshot was published yet
+ */
+bool render_game_present(game_ptr game);
+
+/**
+ * @brief Capture and present the complete game scene on one thread
  * @param game Game state to render
  */
 void render_game(game_ptr game);
@@ -0,0 +1,78 @@
+/**
+ * @file lake_layer.c
+ * @brief Pre-baked lake gradient implementation
+ */
+
+#include "lake_layer.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+color_t lake_gradient_classic(float depth) {
+    // Gradient from cyan (0, 255, 255) to dark blue (0, 0, 100)
+    int green_value = (int)(255 * (1.0f - depth)); // From 255 to 0
+    int blue_value = (int)(255 - depth * 155);     // From 255 to 100
+    return COLOR(0, green_value, blue_value);
+}
+
+bool lake_layer_bake(lake_layer_ptr lake, graphics_context_t *graphics_context, lake_gradient_fn_t gradient, int width,
+                     int height) {
+    if (!gradient || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    // The stretch width costs nothing to change; only a new height or gradient needs new pixels
+    lake->width = width;
+    if (lake->texture.texture && lake->gradient == gradient && lake->height == height) {
+        return true;
+    }
+
+    lake_layer_destroy(lake);
+    lake->width = width;
+
+    uint32_t *pixels = malloc((size_t)height * sizeof(uint32_t));
+    if (!pixels) {
+        return false;
+    }
+
+    for (int y = 0; y < height; y++) {
+        color_t color = gradient((float)y / height);
+        pixels[y] = (uint32_t)color.r << 24 | (uint32_t)color.g << 16 | (uint32_t)color.b << 8 | color.a;
+    }
+
+    SDL_Texture *texture =
+        SDL_CreateTexture(graphics_context->renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC, 1, height);
+    if (texture && SDL_UpdateTexture(texture, NULL, pixels, (int)sizeof(uint32_t)) != 0) {
+        SDL_DestroyTexture(texture);
+        texture = NULL;
+    }
+    free(pixels);
+
+    if (!texture) {
+        return false;
+    }
+
+    lake->texture.texture = texture;
+    lake->texture.width = 1;
+    lake->texture.height = height;
+    lake->gradient = gradient;
+    lake->height = height;
+    return true;
+}
+
+void lake_layer_render(const lake_layer_t *lake, graphics_context_t *graphics_context, int x, int y) {
+    if (!lake->texture.texture) {
+        return;
+    }
+
+    SDL_Rect destination = {x, y, lake->width, lake->height};
+    SDL_RenderCopy(graphics_context->renderer, lake->texture.texture, NULL, &destination);
+}
+
+void lake_layer_destroy(lake_layer_ptr lake) {
+    if (lake->texture.texture) {
+        free_texture(&lake->texture);
+    }
+    memset(lake, 0, sizeof(*lake));
+}
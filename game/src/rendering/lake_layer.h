@@ -0,0 +1,70 @@
+/**
+ * @file lake_layer.h
+ * @brief Pre-baked lake gradient
+ *
+ * The lake is a vertical color gradient, so it is baked once into a texture
+ * one pixel wide and stretched across the screen with a single copy. The
+ * gradient is a plain function from depth to color and is kept with the
+ * layer, so the lake can be themed by baking it with a different function.
+ */
+
+#ifndef LAKE_LAYER_H
+#define LAKE_LAYER_H
+
+#include "graphics.h"
+#include "texture.h"
+#include <stdbool.h>
+
+/**
+ * Lake color at a depth, from 0 at the surface towards 1 at the bottom
+ */
+typedef color_t (*lake_gradient_fn_t)(float depth);
+
+/**
+ * Baked lake gradient
+ */
+typedef struct {
+    texture_t texture;           // One column of gradient pixels (height rows)
+    lake_gradient_fn_t gradient; // Function the texture was baked from
+    int width;                   // Width the column is stretched to
+    int height;                  // Lake height in pixels
+} lake_layer_t;
+
+// Pointer typedef for lake layer
+typedef lake_layer_t *lake_layer_ptr;
+
+/**
+ * @brief Original arcade lake: cyan at the surface fading to dark blue
+ * @param depth Depth from 0 (surface) towards 1 (bottom)
+ * @return Lake color at that depth
+ */
+color_t lake_gradient_classic(float depth);
+
+/**
+ * @brief Bake the gradient texture, unless it is already baked with the same gradient and size
+ * @param lake Lake layer (zero-initialized before the first bake)
+ * @param graphics_context Graphics context owning the texture
+ * @param gradient Gradient function
+ * @param width Lake width in pixels
+ * @param height Lake height in pixels
+ * @return true if the layer holds a texture for the requested gradient and size
+ */
+bool lake_layer_bake(lake_layer_ptr lake, graphics_context_t *graphics_context, lake_gradient_fn_t gradient, int width,
+                     int height);
+
+/**
+ * @brief Draw the lake with one texture copy
+ * @param lake Lake layer
+ * @param graphics_context Graphics context to draw into
+ * @param x Left edge of the lake
+ * @param y Surface of the lake
+ */
+void lake_layer_render(const lake_layer_t *lake, graphics_context_t *graphics_context, int x, int y);
+
+/**
+ * @brief Free the gradient texture
+ * @param lake Lake layer
+ */
+void lake_layer_destroy(lake_layer_ptr lake);
+
+#endif // LAKE_LAYER_H
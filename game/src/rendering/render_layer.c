@@ -0,0 +1,102 @@
+/**
+ * @file render_layer.c
+ * @brief Cached render-target layers implementation
+ */
+
+#include "render_layer.h"
+
+#include <string.h>
+
+static bool create_target(render_layer_ptr layer, graphics_context_t *graphics_context, int width, int height) {
+    SDL_Texture *texture = SDL_CreateTexture(graphics_context->renderer, SDL_PIXELFORMAT_RGBA8888,
+                                             SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!texture) {
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(texture, layer->blend_mode);
+    layer->texture.texture = texture;
+    layer->texture.width = width;
+    layer->texture.height = height;
+    layer->dirty = true;
+    return true;
+}
+
+bool render_layer_init(render_layer_ptr layer, graphics_context_t *graphics_context, int width, int height,
+                       int blend_mode) {
+    memset(layer, 0, sizeof(*layer));
+
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    layer->blend_mode = blend_mode;
+    return create_target(layer, graphics_context, width, height);
+}
+
+bool render_layer_resize(render_layer_ptr layer, graphics_context_t *graphics_context, int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    if (layer->texture.texture && layer->texture.width == width && layer->texture.height == height) {
+        return true;
+    }
+
+    if (layer->texture.texture) {
+        free_texture(&layer->texture);
+    }
+    return create_target(layer, graphics_context, width, height);
+}
+
+bool render_layer_begin(render_layer_ptr layer, graphics_context_t *graphics_context) {
+    if (!layer->texture.texture || SDL_SetRenderTarget(graphics_context->renderer, layer->texture.texture) != 0) {
+        return false;
+    }
+
+    // Transparent, so overlay layers only cover what they draw
+    SDL_SetRenderDrawColor(graphics_context->renderer, 0, 0, 0, 0);
+    SDL_RenderClear(graphics_context->renderer);
+    return true;
+}
+
+void render_layer_end(render_layer_ptr layer, graphics_context_t *graphics_context) {
+    SDL_SetRenderTarget(graphics_context->renderer, NULL);
+    layer->dirty = false;
+}
+
+void render_layer_composite(const render_layer_t *layer, graphics_context_t *graphics_context) {
+    if (!layer->texture.texture) {
+        return;
+    }
+
+    SDL_RenderCopy(graphics_context->renderer, layer->texture.texture, NULL, NULL);
+}
+
+void render_layer_destroy(render_layer_ptr layer) {
+    if (layer->texture.texture) {
+        free_texture(&layer->texture);
+    }
+    memset(layer, 0, sizeof(*layer));
+}
+
+static int count_reset(void *userdata, SDL_Event *event) {
+    if (event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET) {
+        SDL_AtomicAdd((SDL_atomic_t *)userdata, 1);
+    }
+    return 1;
+}
+
+void render_layer_watch_resets(SDL_atomic_t *resets) { SDL_AddEventWatch(count_reset, resets); }
+
+void render_layer_unwatch_resets(SDL_atomic_t *resets) { SDL_DelEventWatch(count_reset, resets); }
+
+bool render_layer_targets_lost(SDL_atomic_t *resets, int *seen) {
+    int count = SDL_AtomicGet(resets);
+    if (count == *seen) {
+        return false;
+    }
+
+    *seen = count;
+    return true;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file render_layer.h
+ * @brief Cached render-target layers with dirty tracking
+ *
+ * A layer is a render-target texture holding a part of the frame that
+ * rarely changes (the background, the HUD). Its contents are redrawn only
+ * after it has been marked dirty, and every frame composites it with a
+ * single copy.
+ *
+ * Usage per frame:
+ * @code
+ * if (render_layer_needs_redraw(&layer) && render_layer_begin(&layer, context)) {
+ *     ... draw the layer contents ...
+ *     render_layer_end(&layer, context);
+ * }
+ * render_layer_composite(&layer, context);
+ * @endcode
+ *
+ * The renderer can drop the contents of every render target (a lost or
+ * reset device). The engine's event polling does not report it, so an SDL
+ * event watch counts the resets and whoever holds drawn targets compares
+ * the count with the one it last drew at.
+ */
+
+#ifndef RENDER_LAYER_H
+#define RENDER_LAYER_H
+
+#include "graphics.h"
+#include "texture.h"
+#include <stdbool.h>
+
+/**
+ * Cached layer
+ */
+typedef struct {
+    texture_t texture; // Render target holding the cached contents
+    int blend_mode;    // SDL_BLENDMODE_NONE for opaque layers, SDL_BLENDMODE_BLEND for overlays
+    bool dirty;        // Contents must be redrawn before the next composite
+} render_layer_t;
+
+// Pointer typedef for render layer
+typedef render_layer_t *render_layer_ptr;
+
+/**
+ * @brief Create a layer (created dirty)
+ * @param layer Layer to initialize
+ * @param graphics_context Graphics context owning the render target
+ * @param width Layer width in logical pixels
+ * @param height Layer height in logical pixels
+ * @param blend_mode How the layer is composited (SDL_BLENDMODE_NONE or SDL_BLENDMODE_BLEND)
+ * @return true if successful
+ */
+bool render_layer_init(render_layer_ptr layer, graphics_context_t *graphics_context, int width, int height,
+                       int blend_mode);
+
+/**
+ * @brief Recreate the render target if the size changed (a recreated layer is dirty)
+ * @param layer Layer
+ * @param graphics_context Graphics context owning the render target
+ * @param width Layer width in logical pixels
+ * @param height Layer height in logical pixels
+ * @return true if the layer has a render target of the requested size
+ */
+bool render_layer_resize(render_layer_ptr layer, graphics_context_t *graphics_context, int width, int height);
+
+/**
+ * @brief Mark a layer for redrawing
+ * @param layer Layer
+ */
+static inline void render_layer_mark_dirty(render_layer_ptr layer) { layer->dirty = true; }
+
+/**
+ * @brief Check whether a layer has to be redrawn
+ * @param layer Layer
+ * @return true if the layer is dirty
+ */
+static inline bool render_layer_needs_redraw(const render_layer_t *layer) { return layer->dirty; }
+
+/**
+ * @brief Redirect drawing into the layer and clear it to transparent
+ * @param layer Layer
+ * @param graphics_context Graphics context
+ * @return true if drawing now goes to the layer
+ */
+bool render_layer_begin(render_layer_ptr layer, graphics_context_t *graphics_context);
+
+/**
+ * @brief Send drawing back to the screen and mark the layer clean
+ * @param layer Layer
+ * @param graphics_context Graphics context
+ */
+void render_layer_end(render_layer_ptr layer, graphics_context_t *graphics_context);
+
+/**
+ * @brief Copy the cached contents over the whole logical screen
+ * @param layer Layer
+ * @param graphics_context Graphics context
+ */
+void render_layer_composite(const render_layer_t *layer, graphics_context_t *graphics_context);
+
+/**
+ * @brief Free the render target
+ * @param layer Layer
+ */
+void render_layer_destroy(render_layer_ptr layer);
+
+/**
+ * @brief Count SDL_RENDER_TARGETS_RESET and SDL_RENDER_DEVICE_RESET events as they are queued
+ * @param resets Counter, incremented once per reset
+ */
+void render_layer_watch_resets(SDL_atomic_t *resets);
+
+/**
+ * @brief Stop counting resets into a counter
+ * @param resets Counter passed to render_layer_watch_resets
+ */
+void render_layer_unwatch_resets(SDL_atomic_t *resets);
+
+/**
+ * @brief Check whether the render targets were reset since the caller last drew into them
+ * @param resets Counter passed to render_layer_watch_resets
+ * @param seen Reset count the caller last drew at (brought up to date)
+ * @return true if everything drawn into render targets before has to be drawn again
+ */
+bool render_layer_targets_lost(SDL_atomic_t *resets, int *seen);
+
+#endif // RENDER_LAYER_H
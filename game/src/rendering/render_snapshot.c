@@ -0,0 +1,93 @@
+/**
+ * @file render_snapshot.c
+ * @brief Render snapshot and triple buffer implementation
+ */
+
+#include "render_snapshot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define RENDER_SNAPSHOT_INDEX 0x3 // Snapshot index held in the middle slot
+#define RENDER_SNAPSHOT_FRESH 0x4 // The middle snapshot has not been picked up yet
+
+bool render_snapshot_buffer_init(render_snapshot_buffer_ptr buffer, size_t sprite_capacity,
+                                 const particle_system_t *particles) {
+    memset(buffer, 0, sizeof(*buffer));
+
+    bool allocated = sprite_capacity > 0;
+    for (int i = 0; i < 3 && allocated; i++) {
+        render_snapshot_ptr snapshot = &buffer->snapshots[i];
+        snapshot->sprites = malloc(sprite_capacity * sizeof(sprite_draw_t));
+        snapshot->sprite_capacity = sprite_capacity;
+        allocated = snapshot->sprites != NULL &&
+                    particle_system_init(&snapshot->particles, particles->capacity, particles->gravity,
+                                         particles->floor_y, particles->size, 0);
+    }
+    if (!allocated) {
+        render_snapshot_buffer_destroy(buffer);
+        return false;
+    }
+
+    buffer->back = 0;
+    SDL_AtomicSet(&buffer->middle, 1);
+    buffer->front = 2;
+    return true;
+}
+
+void render_snapshot_buffer_reset(render_snapshot_buffer_ptr buffer) {
+    SDL_AtomicSet(&buffer->middle, SDL_AtomicGet(&buffer->middle) & RENDER_SNAPSHOT_INDEX);
+    buffer->has_front = false;
+}
+
+render_snapshot_ptr render_snapshot_begin(render_snapshot_buffer_ptr buffer) {
+    render_snapshot_ptr snapshot = &buffer->snapshots[buffer->back];
+    snapshot->sprite_count = 0;
+    return snapshot;
+}
+
+void render_snapshot_add_sprite(render_snapshot_ptr snapshot, const sprite_rect_t *sprite, int x, int y, int scale,
+                                flip_t flip) {
+    // An entity left without an animation (the table was full) has no frame to draw
+    if (!sprite) {
+        return;
+    }
+
+    if (snapshot->sprite_count == snapshot->sprite_capacity) {
+        // More sprites than planned for; a failed grow only drops sprites from this frame
+        size_t capacity = snapshot->sprite_capacity * 2;
+        sprite_draw_t *sprites = realloc(snapshot->sprites, capacity * sizeof(sprite_draw_t));
+        if (!sprites) {
+            return;
+        }
+        snapshot->sprites = sprites;
+        snapshot->sprite_capacity = capacity;
+    }
+
+    snapshot->sprites[snapshot->sprite_count++] = (sprite_draw_t){sprite, x, y, scale, flip};
+}
+
+void render_snapshot_publish(render_snapshot_buffer_ptr buffer) {
+    // The exchange is a full barrier: every write to the back snapshot is visible before it becomes the middle
+    int previous = SDL_AtomicSet(&buffer->middle, buffer->back | RENDER_SNAPSHOT_FRESH);
+    buffer->back = previous & RENDER_SNAPSHOT_INDEX;
+}
+
+render_snapshot_ptr render_snapshot_latest(render_snapshot_buffer_ptr buffer) {
+    if (SDL_AtomicGet(&buffer->middle) & RENDER_SNAPSHOT_FRESH) {
+        // Only the renderer clears the flag, so the middle is still fresh when swapped out
+        int previous = SDL_AtomicSet(&buffer->middle, buffer->front);
+        buffer->front = previous & RENDER_SNAPSHOT_INDEX;
+        buffer->has_front = true;
+    }
+
+    return buffer->has_front ? &buffer->snapshots[buffer->front] : NULL;
+}
+
+void render_snapshot_buffer_destroy(render_snapshot_buffer_ptr buffer) {
+    for (int i = 0; i < 3; i++) {
+        free(buffer->snapshots[i].sprites);
+        particle_system_destroy(&buffer->snapshots[i].particles);
+    }
+    memset(buffer, 0, sizeof(*buffer));
+}
@@ -0,0 +1,122 @@
+/**
+ * @file render_snapshot.h
+ * @brief Renderable game state and the triple buffer it is handed over in
+ *
+ * At the end of a tick the simulation records everything a frame shows:
+ * each sprite with its position, scale and mirroring, a copy of the live
+ * particles, and the HUD values. The snapshot is then published to a
+ * lock-free triple buffer. The simulation always writes the back snapshot,
+ * the renderer always reads the front one, and publishing or picking up
+ * the latest snapshot swaps with the middle one in a single atomic
+ * exchange. Neither side ever waits for the other: the simulation
+ * overwrites snapshots the renderer never saw, and the renderer redraws
+ * the last one until a newer one arrives.
+ */
+
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include "SDL.h"
+#include "graphics.h"
+#include "kinematics.h"
+#include "particle_system.h"
+#include "sprite_atlas.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * One sprite of a frame
+ */
+typedef struct {
+    const sprite_rect_t *sprite; // Sprite rectangle in the sprite sheet
+    int x;                       // Destination left edge
+    int y;                       // Destination top edge
+    int scale;                   // Whole-number scale
+    flip_t flip;                 // Mirroring
+} sprite_draw_t;
+
+/**
+ * Everything one frame shows, in drawing order
+ */
+typedef struct {
+    sprite_draw_t *sprites;      // Entity sprites, back to front
+    size_t sprite_count;         // Sprites recorded
+    size_t sprite_capacity;      // Allocated sprites (grown if a frame needs more)
+    particle_system_t particles; // Live particles at the end of the tick
+    int lives;                   // HUD lives
+    int score;                   // HUD score
+    sim_tick_t tick;             // Simulation tick the snapshot was taken at
+} render_snapshot_t;
+
+// Pointer typedef for render snapshot
+typedef render_snapshot_t *render_snapshot_ptr;
+
+/**
+ * Three snapshots handed from the simulation to the renderer
+ */
+typedef struct {
+    render_snapshot_t snapshots[3];
+    int back;            // Snapshot the simulation writes (simulation side only)
+    int front;           // Snapshot the renderer reads (renderer side only)
+    SDL_atomic_t middle; // Spare snapshot, with RENDER_SNAPSHOT_FRESH set when it is newer than front
+    bool has_front;      // The renderer has picked up at least one snapshot
+} render_snapshot_buffer_t;
+
+// Pointer typedef for render snapshot buffer
+typedef render_snapshot_buffer_t *render_snapshot_buffer_ptr;
+
+/**
+ * @brief Allocate the three snapshots
+ * @param buffer Snapshot buffer to initialize
+ * @param sprite_capacity Sprites per snapshot to start with
+ * @param particles Particle system the snapshots copy (sets their particle capacity)
+ * @return true if successful
+ */
+bool render_snapshot_buffer_init(render_snapshot_buffer_ptr buffer, size_t sprite_capacity,
+                                 const particle_system_t *particles);
+
+/**
+ * @brief Forget every published snapshot (while neither side is using the buffer)
+ * @param buffer Snapshot buffer
+ */
+void render_snapshot_buffer_reset(render_snapshot_buffer_ptr buffer);
+
+/**
+ * @brief Snapshot for the simulation to fill (emptied of sprites)
+ * @param buffer Snapshot buffer
+ * @return Back snapshot
+ */
+render_snapshot_ptr render_snapshot_begin(render_snapshot_buffer_ptr buffer);
+
+/**
+ * @brief Record a sprite
+ * @param snapshot Snapshot being filled
+ * @param sprite Sprite rectangle (NULL records nothing)
+ * @param x Destination left edge
+ * @param y Destination top edge
+ * @param scale Whole-number scale
+ * @param flip Mirroring
+ */
+void render_snapshot_add_sprite(render_snapshot_ptr snapshot, const sprite_rect_t *sprite, int x, int y, int scale,
+                                flip_t flip);
+
+/**
+ * @brief Hand the filled back snapshot to the renderer
+ * @param buffer Snapshot buffer
+ */
+void render_snapshot_publish(render_snapshot_buffer_ptr buffer);
+
+/**
+ * @brief Latest published snapshot, for the renderer
+ * @param buffer Snapshot buffer
+ * @return Front snapshot (the renderer's until its next call), or NULL if nothing was published yet
+ */
+render_snapshot_ptr render_snapshot_latest(render_snapshot_buffer_ptr buffer);
+
+/**
+ * @brief Free the snapshots
+ * @param buffer Snapshot buffer
+ */
+void render_snapshot_buffer_destroy(render_snapshot_buffer_ptr buffer);
+
+#endif // RENDER_SNAPSHOT_H
@@ -0,0 +1,283 @@
+/**
+ * @file soft_raster.c
+ * @brief CPU framebuffer and SIMD drawing kernels implementation
+ */
+
+#include "soft_raster.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define SOFT_RASTER_ALIGNMENT 32 // One AVX2 vector
+#define SOFT_RASTER_LANES 8      // Pixels per AVX2 vector
+
+static int clamp_int(int value, int low, int high) { return value < low ? low : (value > high ? high : value); }
+
+static void fill_row(uint32_t *dst, int count, uint32_t color) {
+    int i = 0;
+#if defined(__AVX2__)
+    __m256i fill = _mm256_set1_epi32((int)color);
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256((__m256i *)(dst + i), fill);
+    }
+#elif defined(__SSE2__)
+    __m128i fill = _mm_set1_epi32((int)color);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128((__m128i *)(dst + i), fill);
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = color;
+    }
+}
+
+// dst[i] = src[i] unless src[i] is the color key
+static void keyed_copy_row(uint32_t *dst, const uint32_t *src, int count, uint32_t key) {
+    int i = 0;
+#if defined(__AVX2__)
+    __m256i keys = _mm256_set1_epi32((int)key);
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        __m256i keyed = _mm256_cmpeq_epi32(s, keys);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_blendv_epi8(s, d, keyed));
+    }
+#elif defined(__SSE2__)
+    __m128i keys = _mm_set1_epi32((int)key);
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i keyed = _mm_cmpeq_epi32(s, keys);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(keyed, d), _mm_andnot_si128(keyed, s)));
+    }
+#endif
+    for (; i < count; i++) {
+        if (src[i] != key) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+// dst[i] = src[count - 1 - i]
+static void reverse_row(uint32_t *dst, const uint32_t *src, int count) {
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256i reversed = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + count - 8 - i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permutevar8x32_epi32(s, reversed));
+    }
+#elif defined(__SSE2__)
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + count - 4 - i));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi32(s, _MM_SHUFFLE(0, 1, 2, 3)));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = src[count - 1 - i];
+    }
+}
+
+// Each source pixel repeated scale times (2x is the common case and gets the vector path)
+static void expand_row(uint32_t *dst, const uint32_t *src, int count, int scale) {
+    int i = 0;
+#if defined(__SSE2__) || defined(__AVX2__)
+    if (scale == 2) {
+        for (; i + 4 <= count; i += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+            _mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi32(s, s));
+            _mm_storeu_si128((__m128i *)(dst + 2 * i + 4), _mm_unpackhi_epi32(s, s));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        for (int k = 0; k < scale; k++) {
+            dst[i * scale + k] = src[i];
+        }
+    }
+}
+
+static uint32_t blend_channel(uint32_t src, uint32_t dst, uint32_t alpha) {
+    // Exact division by 255, as the GPU path's 8-bit blending
+    uint32_t value = src * alpha + dst * (255 - alpha) + 128;
+    return (value + (value >> 8)) >> 8;
+}
+
+bool soft_framebuffer_init(soft_framebuffer_ptr framebuffer, int width, int height) {
+    memset(framebuffer, 0, sizeof(*framebuffer));
+
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    // Rows padded to whole vectors. After the pixels: a mirrored row, then an expanded row, which can overhang
+    // the screen by up to one scaled pixel on each side
+    int pitch = (width + SOFT_RASTER_LANES - 1) / SOFT_RASTER_LANES * SOFT_RASTER_LANES;
+    size_t pixel_count = (size_t)pitch * (size_t)height;
+    size_t scratch_count = 2 * (size_t)pitch + 2 * SOFT_RASTER_MAX_SCALE;
+    framebuffer->block = malloc((pixel_count + scratch_count) * sizeof(uint32_t) + SOFT_RASTER_ALIGNMENT - 1);
+    if (!framebuffer->block) {
+        return false;
+    }
+
+    uintptr_t aligned =
+        ((uintptr_t)framebuffer->block + SOFT_RASTER_ALIGNMENT - 1) & ~(uintptr_t)(SOFT_RASTER_ALIGNMENT - 1);
+    framebuffer->pixels = (uint32_t *)aligned;
+    framebuffer->scratch = framebuffer->pixels + pixel_count;
+    framebuffer->width = width;
+    framebuffer->height = height;
+    framebuffer->pitch = pitch;
+    memset(framebuffer->pixels, 0, pixel_count * sizeof(uint32_t));
+    return true;
+}
+
+void soft_fill_rect(soft_framebuffer_ptr framebuffer, int x, int y, int width, int height, uint32_t color) {
+    int left = clamp_int(x, 0, framebuffer->width);
+    int right = clamp_int(x + width, 0, framebuffer->width);
+    int top = clamp_int(y, 0, framebuffer->height);
+    int bottom = clamp_int(y + height, 0, framebuffer->height);
+
+    for (int row = top; row < bottom; row++) {
+        fill_row(framebuffer->pixels + (size_t)row * framebuffer->pitch + left, right - left, color);
+    }
+}
+
+void soft_blend_rect(soft_framebuffer_ptr framebuffer, int x, int y, int width, int height, color_t color) {
+    if (color.a == 255) {
+        soft_fill_rect(framebuffer, x, y, width, height, soft_pixel(color));
+        return;
+    }
+
+    int left = clamp_int(x, 0, framebuffer->width);
+    int right = clamp_int(x + width, 0, framebuffer->width);
+    int top = clamp_int(y, 0, framebuffer->height);
+    int bottom = clamp_int(y + height, 0, framebuffer->height);
+    uint32_t alpha = color.a;
+
+    // Particle-sized rectangles; not worth a vector path
+    for (int row = top; row < bottom; row++) {
+        uint32_t *pixel = framebuffer->pixels + (size_t)row * framebuffer->pitch;
+        for (int column = left; column < right; column++) {
+            uint32_t dst = pixel[column];
+            uint32_t r = blend_channel(color.r, (dst >> 16) & 0xFF, alpha);
+            uint32_t g = blend_channel(color.g, (dst >> 8) & 0xFF, alpha);
+            uint32_t b = blend_channel(color.b, dst & 0xFF, alpha);
+            pixel[column] = (dst & 0xFF000000u) | r << 16 | g << 8 | b;
+        }
+    }
+}
+
+void soft_draw_line(soft_framebuffer_ptr framebuffer, int x0, int y0, int x1, int y1, uint32_t color) {
+    // Horizontal lines (all the lake and HUD needs) are a row fill
+    if (y0 == y1) {
+        int left = x0 < x1 ? x0 : x1;
+        int right = x0 < x1 ? x1 : x0;
+        soft_fill_rect(framebuffer, left, y0, right - left + 1, 1, color);
+        return;
+    }
+
+    // Bresenham, clipping per pixel
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int step_x = x0 < x1 ? 1 : -1;
+    int step_y = y0 < y1 ? 1 : -1;
+    int error = dx + dy;
+
+    for (;;) {
+        if (x0 >= 0 && x0 < framebuffer->width && y0 >= 0 && y0 < framebuffer->height) {
+            framebuffer->pixels[(size_t)y0 * framebuffer->pitch + x0] = color;
+        }
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+
+        int doubled = 2 * error;
+        if (doubled >= dy) {
+            error += dy;
+            x0 += step_x;
+        }
+        if (doubled <= dx) {
+            error += dx;
+            y0 += step_y;
+        }
+    }
+}
+
+void soft_blit(soft_framebuffer_ptr framebuffer, const soft_image_t *image, const sprite_rect_t *source, int x, int y,
+               int scale, flip_t flip) {
+    if (scale < 1 || scale > SOFT_RASTER_MAX_SCALE || source->w <= 0 || source->h <= 0 || source->x < 0 ||
+        source->y < 0 || source->x + source->w > image->width || source->y + source->h > image->height) {
+        return;
+    }
+
+    // Destination area actually on screen
+    int left = clamp_int(x, 0, framebuffer->width);
+    int right = clamp_int(x + source->w * scale, 0, framebuffer->width);
+    int top = clamp_int(y, 0, framebuffer->height);
+    int bottom = clamp_int(y + source->h * scale, 0, framebuffer->height);
+    if (left >= right || top >= bottom) {
+        return;
+    }
+
+    // Output columns [first_column, last_column] of the sprite cover the visible span
+    int first_column = (left - x) / scale;
+    int last_column = (right - 1 - x) / scale;
+    int columns = last_column - first_column + 1;
+    int skip = (left - x) - first_column * scale; // Expanded pixels left of the screen edge
+    int span = right - left;
+
+    uint32_t *mirrored = framebuffer->scratch;
+    uint32_t *expanded = framebuffer->scratch + framebuffer->pitch;
+
+    int first_row = (top - y) / scale;
+    int last_row = (bottom - 1 - y) / scale;
+    for (int row = first_row; row <= last_row; row++) {
+        int source_row = flip == FLIP_VERTICAL ? source->h - 1 - row : row;
+        const uint32_t *pixels = image->pixels + (size_t)(source->y + source_row) * image->pitch + source->x;
+
+        // Sprite columns in output order
+        const uint32_t *line = pixels + first_column;
+        if (flip == FLIP_HORIZONTAL) {
+            reverse_row(mirrored, pixels + source->w - 1 - last_column, columns);
+            line = mirrored;
+        }
+
+        if (scale > 1) {
+            expand_row(expanded, line, columns, scale);
+            line = expanded;
+        }
+
+        // One expanded source row feeds up to scale destination rows
+        int band_top = clamp_int(y + row * scale, top, bottom);
+        int band_bottom = clamp_int(y + (row + 1) * scale, top, bottom);
+        for (int dst_row = band_top; dst_row < band_bottom; dst_row++) {
+            keyed_copy_row(framebuffer->pixels + (size_t)dst_row * framebuffer->pitch + left, line + skip, span,
+                           image->color_key);
+        }
+    }
+}
+
+uint64_t soft_framebuffer_hash(const soft_framebuffer_t *framebuffer) {
+    uint64_t hash = 0xcbf29ce484222325ULL; // FNV-1a 64-bit offset basis
+    for (int row = 0; row < framebuffer->height; row++) {
+        const uint32_t *pixel = framebuffer->pixels + (size_t)row * framebuffer->pitch;
+        for (int column = 0; column < framebuffer->width; column++) {
+            for (int i = 0; i < 4; i++) {
+                hash ^= (pixel[column] >> (8 * i)) & 0xFFU;
+                hash *= 0x100000001b3ULL; // FNV-1a 64-bit prime
+            }
+        }
+    }
+    return hash;
+}
+
+void soft_framebuffer_destroy(soft_framebuffer_ptr framebuffer) {
+    free(framebuffer->block);
+    memset(framebuffer, 0, sizeof(*framebuffer));
+}
@@ -0,0 +1,130 @@
+/**
+ * @file soft_raster.h
+ * @brief CPU framebuffer and SIMD drawing kernels
+ *
+ * Draws into a 32-bit ARGB framebuffer in system memory, for machines
+ * without a GPU and for headless capture. Sprite blits are color-keyed,
+ * scaled by whole numbers and optionally mirrored, matching the nearest
+ * neighbour sampling the GPU path uses for pixel art, so both paths produce
+ * the same pixels for the same frame.
+ *
+ * The row kernels (fills, keyed copies, mirrored copies and 2x expansion)
+ * use AVX2 when the build enables it, SSE2 otherwise, with scalar loops
+ * for the remaining pixels and for other targets.
+ */
+
+#ifndef SOFT_RASTER_H
+#define SOFT_RASTER_H
+
+#include "graphics.h"
+#include "sprite_atlas.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Largest blit scale (bounds the scratch rows)
+#define SOFT_RASTER_MAX_SCALE 16
+
+/**
+ * Framebuffer (rows start on 32-byte boundaries)
+ */
+typedef struct {
+    uint32_t *pixels;  // ARGB8888, pitch pixels per row
+    int width;         // Visible width in pixels
+    int height;        // Height in pixels
+    int pitch;         // Row length in pixels (width rounded up to a whole vector)
+    uint32_t *scratch; // Working rows for mirrored and scaled blits
+    void *block;       // Allocation the pixels and scratch rows live in
+} soft_framebuffer_t;
+
+// Pointer typedef for soft framebuffer
+typedef soft_framebuffer_t *soft_framebuffer_ptr;
+
+/**
+ * Source image for blits (pixels are not owned)
+ */
+typedef struct {
+    const uint32_t *pixels; // ARGB8888
+    int width;              // Width in pixels
+    int height;             // Height in pixels
+    int pitch;              // Row length in pixels
+    uint32_t color_key;     // Pixels with exactly this value are not drawn
+} soft_image_t;
+
+/**
+ * @brief Pack a color into a framebuffer pixel
+ * @param color Color
+ * @return ARGB8888 pixel
+ */
+static inline uint32_t soft_pixel(color_t color) {
+    return (uint32_t)color.a << 24 | (uint32_t)color.r << 16 | (uint32_t)color.g << 8 | color.b;
+}
+
+/**
+ * @brief Allocate a framebuffer
+ * @param framebuffer Framebuffer to initialize
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @return true if successful
+ */
+bool soft_framebuffer_init(soft_framebuffer_ptr framebuffer, int width, int height);
+
+/**
+ * @brief Fill a rectangle (clipped to the framebuffer)
+ * @param framebuffer Framebuffer
+ * @param x Left edge
+ * @param y Top edge
+ * @param width Width
+ * @param height Height
+ * @param color ARGB8888 pixel
+ */
+void soft_fill_rect(soft_framebuffer_ptr framebuffer, int x, int y, int width, int height, uint32_t color);
+
+/**
+ * @brief Blend a color over a rectangle by its alpha (clipped to the framebuffer)
+ * @param framebuffer Framebuffer
+ * @param x Left edge
+ * @param y Top edge
+ * @param width Width
+ * @param height Height
+ * @param color Color and opacity
+ */
+void soft_blend_rect(soft_framebuffer_ptr framebuffer, int x, int y, int width, int height, color_t color);
+
+/**
+ * @brief Draw a one pixel wide line, end points included (clipped to the framebuffer)
+ * @param framebuffer Framebuffer
+ * @param x0 Start x
+ * @param y0 Start y
+ * @param x1 End x
+ * @param y1 End y
+ * @param color ARGB8888 pixel
+ */
+void soft_draw_line(soft_framebuffer_ptr framebuffer, int x0, int y0, int x1, int y1, uint32_t color);
+
+/**
+ * @brief Draw a color-keyed sprite at a whole-number scale (clipped to the framebuffer)
+ * @param framebuffer Framebuffer
+ * @param image Source image
+ * @param source Sprite rectangle inside the image
+ * @param x Destination left edge
+ * @param y Destination top edge
+ * @param scale Scale factor (1 to SOFT_RASTER_MAX_SCALE)
+ * @param flip Mirroring applied to the sprite
+ */
+void soft_blit(soft_framebuffer_ptr framebuffer, const soft_image_t *image, const sprite_rect_t *source, int x, int y,
+               int scale, flip_t flip);
+
+/**
+ * @brief Hash the visible pixels (FNV-1a), for comparing frames across runs and backends
+ * @param framebuffer Framebuffer
+ * @return Frame hash
+ */
+uint64_t soft_framebuffer_hash(const soft_framebuffer_t *framebuffer);
+
+/**
+ * @brief Free the framebuffer memory
+ * @param framebuffer Framebuffer
+ */
+void soft_framebuffer_destroy(soft_framebuffer_ptr framebuffer);
+
+#endif // SOFT_RASTER_H
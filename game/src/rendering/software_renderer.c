@@ -0,0 +1,143 @@
+/**
+ * @file software_renderer.c
+ * @brief CPU render backend implementation
+ */
+
+#include "software_renderer.h"
+
+#include "SDL_image.h"
+#include "frame.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+// Sprite and font pixels that are not drawn (transparent black, which no drawn pixel can equal)
+#define SOFTWARE_COLOR_KEY 0x00000000u
+
+// Arcade font layout: 8x8 cells, 16 to a row, letters A-Z in the first two rows and digits in the third.
+// The white variant fills the first 32 rows; the other colors repeat it further down.
+#define SOFTWARE_FONT_CELL 8
+#define SOFTWARE_FONT_GLYPH_HEIGHT 7
+#define SOFTWARE_FONT_COLUMNS 16
+#define SOFTWARE_FONT_DIGIT_ROW 2
+
+// Load an image as ARGB8888 with its undrawn pixels folded into the color key
+static bool load_soft_image(const char *path, bool black_is_transparent, SDL_Surface **surface_out,
+                            soft_image_t *image) {
+    SDL_Surface *loaded = IMG_Load(path);
+    if (!loaded) {
+        return false;
+    }
+
+    SDL_Surface *surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_ARGB8888, 0);
+    SDL_FreeSurface(loaded);
+    if (!surface) {
+        return false;
+    }
+
+    // Fold transparent pixels into the one key value the blit kernels test, as the GPU blends them away
+    // (the font's background is opaque black, which the engine keys out the same way)
+    int pitch = surface->pitch / (int)sizeof(uint32_t);
+    uint32_t *pixels = (uint32_t *)surface->pixels;
+    for (int y = 0; y < surface->h; y++) {
+        for (int x = 0; x < surface->w; x++) {
+            uint32_t *pixel = &pixels[(size_t)y * pitch + x];
+            if ((*pixel >> 24) < 128 || (black_is_transparent && (*pixel & 0x00ffffffu) == 0)) {
+                *pixel = SOFTWARE_COLOR_KEY;
+            }
+        }
+    }
+
+    *surface_out = surface;
+    image->pixels = pixels;
+    image->width = surface->w;
+    image->height = surface->h;
+    image->pitch = pitch;
+    image->color_key = SOFTWARE_COLOR_KEY;
+    return true;
+}
+
+bool software_renderer_init(software_renderer_ptr renderer, graphics_context_t *graphics_context,
+                            const char *sprite_sheet_path, const char *font_path, int width, int height) {
+    if (!soft_framebuffer_init(&renderer->framebuffer, width, height)) {
+        return false;
+    }
+
+    if (!load_soft_image(sprite_sheet_path, false, &renderer->sprite_surface, &renderer->sprite_sheet) ||
+        !load_soft_image(font_path, true, &renderer->font_surface, &renderer->font)) {
+        software_renderer_destroy(renderer);
+        return false;
+    }
+
+    renderer->frame_count = 0;
+    if (renderer->offscreen) {
+        return true;
+    }
+
+    renderer->upload = SDL_CreateTexture(graphics_context->renderer, SDL_PIXELFORMAT_ARGB8888,
+                                         SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (!renderer->upload) {
+        software_renderer_destroy(renderer);
+        return false;
+    }
+
+    return true;
+}
+
+int software_renderer_text_width(const char *text) {
+    // Every glyph advances one cell, as with the engine's bitmap font
+    return (int)strlen(text) * SOFTWARE_FONT_CELL;
+}
+
+void software_renderer_draw_text(software_renderer_ptr renderer, const char *text, int x, int y) {
+    for (const char *c = text; *c; c++, x += SOFTWARE_FONT_CELL) {
+        int glyph;
+        if (*c >= '0' && *c <= '9') {
+            glyph = SOFTWARE_FONT_DIGIT_ROW * SOFTWARE_FONT_COLUMNS + (*c - '0');
+        } else if (*c >= 'A' && *c <= 'Z') {
+            glyph = *c - 'A' + (*c >= 'P'); // The first row holds A-O, leaving its last cell empty
+        } else {
+            continue; // Spaces and punctuation leave a gap
+        }
+
+        int cell_x = (glyph % SOFTWARE_FONT_COLUMNS) * SOFTWARE_FONT_CELL;
+        int cell_y = (glyph / SOFTWARE_FONT_COLUMNS) * SOFTWARE_FONT_CELL;
+        sprite_rect_t source = {cell_x, cell_y, SOFTWARE_FONT_CELL, SOFTWARE_FONT_GLYPH_HEIGHT, 0, 0,
+                                SOFTWARE_FONT_CELL, SOFTWARE_FONT_GLYPH_HEIGHT};
+        soft_blit(&renderer->framebuffer, &renderer->font, &source, x, y, 1, FLIP_NONE);
+    }
+}
+
+void software_renderer_present(software_renderer_ptr renderer, graphics_context_t *graphics_context) {
+    soft_framebuffer_ptr framebuffer = &renderer->framebuffer;
+
+    if (renderer->print_frame_hashes) {
+        printf("frame %" PRIu64 " %016" PRIx64 "\n", renderer->frame_count, soft_framebuffer_hash(framebuffer));
+    }
+    renderer->frame_count++;
+
+    if (renderer->offscreen) {
+        return;
+    }
+
+    SDL_UpdateTexture(renderer->upload, NULL, framebuffer->pixels, framebuffer->pitch * (int)sizeof(uint32_t));
+    clear_frame(graphics_context);
+    SDL_RenderCopy(graphics_context->renderer, renderer->upload, NULL, NULL);
+    render_frame(graphics_context);
+}
+
+void software_renderer_destroy(software_renderer_ptr renderer) {
+    soft_framebuffer_destroy(&renderer->framebuffer);
+    if (renderer->sprite_surface) {
+        SDL_FreeSurface(renderer->sprite_surface);
+        renderer->sprite_surface = NULL;
+    }
+    if (renderer->font_surface) {
+        SDL_FreeSurface(renderer->font_surface);
+        renderer->font_surface = NULL;
+    }
+    if (renderer->upload) {
+        SDL_DestroyTexture(renderer->upload);
+        renderer->upload = NULL;
+    }
+}
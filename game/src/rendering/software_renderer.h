@@ -0,0 +1,88 @@
+/**
+ * @file software_renderer.h
+ * @brief CPU render backend for the playing screen
+ *
+ * Selected at startup with --software-renderer. The playing screen is then
+ * drawn into a CPU framebuffer with the soft_raster kernels, from a system
+ * memory copy of the sprite sheet, and presented with one texture upload
+ * and copy, so the frame costs the same on machines with and without a GPU.
+ * HUD text is blitted glyph by glyph from a system memory copy of the
+ * arcade font.
+ * With --frame-hashes every presented frame's hash is printed, for frame
+ * comparison tests. Offscreen, frames are only left in the framebuffer for
+ * the caller to capture (video export), with no texture or window involved.
+ */
+
+#ifndef SOFTWARE_RENDERER_H
+#define SOFTWARE_RENDERER_H
+
+#include "graphics.h"
+#include "soft_raster.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Software render backend
+ */
+typedef struct {
+    bool enabled;                   // Playing frames are drawn on the CPU
+    bool print_frame_hashes;        // Print the hash of every presented frame
+    bool offscreen;                 // Frames stay in the framebuffer (no upload texture, nothing presented)
+    soft_framebuffer_t framebuffer; // Frame being drawn
+    SDL_Surface *sprite_surface;    // ARGB8888 copy of the sprite sheet
+    soft_image_t sprite_sheet;      // Blit source over sprite_surface
+    SDL_Surface *font_surface;      // ARGB8888 copy of the arcade font
+    soft_image_t font;              // Blit source over font_surface
+    SDL_Texture *upload;            // Streaming texture the framebuffer is presented through
+    uint64_t frame_count;           // Frames presented
+} software_renderer_t;
+
+// Pointer typedef for software renderer
+typedef software_renderer_t *software_renderer_ptr;
+
+/**
+ * @brief Allocate the framebuffer and load the CPU copies of the sprite sheet and font
+ * @param renderer Software renderer (enabled, print_frame_hashes and offscreen are kept)
+ * @param graphics_context Graphics context presenting the frames
+ * @param sprite_sheet_path Sprite atlas image (alpha-blended, as on the GPU path)
+ * @param font_path Arcade font image (black background keyed out, as by the engine's bitmap font)
+ * @param width Frame width
+ * @param height Frame height
+ * @return true if successful
+ */
+bool software_renderer_init(software_renderer_ptr renderer, graphics_context_t *graphics_context,
+                            const char *sprite_sheet_path, const char *font_path, int width, int height);
+
+/**
+ * @brief Width of a string drawn by software_renderer_draw_text
+ * @param text String
+ * @return Width in pixels
+ */
+int software_renderer_text_width(const char *text);
+
+/**
+ * @brief Draw a string in the white arcade font into the framebuffer
+ *
+ * Digits and capital letters are drawn; any other character leaves a gap.
+ *
+ * @param renderer Software renderer
+ * @param text String
+ * @param x Left edge
+ * @param y Top edge
+ */
+void software_renderer_draw_text(software_renderer_ptr renderer, const char *text, int x, int y);
+
+/**
+ * @brief Upload the framebuffer and present it (offscreen, only count and hash it)
+ * @param renderer Software renderer
+ * @param graphics_context Graphics context
+ */
+void software_renderer_present(software_renderer_ptr renderer, graphics_context_t *graphics_context);
+
+/**
+ * @brief Free the framebuffer, sprite sheet and font copies and upload texture
+ * @param renderer Software renderer
+ */
+void software_renderer_destroy(software_renderer_ptr renderer);
+
+#endif // SOFTWARE_RENDERER_H
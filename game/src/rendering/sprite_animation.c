@@ -0,0 +1,107 @@
+/**
+ * @file sprite_animation.c
+ * @brief Centralized sprite animation implementation
+ */
+
+#include "sprite_animation.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+bool sprite_animation_system_init(sprite_animation_system_ptr system, size_t capacity) {
+    memset(system, 0, sizeof(*system));
+
+    if (capacity == 0) {
+        return false;
+    }
+
+    system->clips = calloc(capacity, sizeof(uint8_t));
+    system->start_times = calloc(capacity, sizeof(timestamp_ms_t));
+    system->phase_offsets_ms = calloc(capacity, sizeof(uint32_t));
+    system->frames = calloc(capacity, sizeof(const sprite_rect_t *));
+    system->free_ids = malloc(capacity * sizeof(sprite_animation_id_t));
+    if (!system->clips || !system->start_times || !system->phase_offsets_ms || !system->frames || !system->free_ids) {
+        sprite_animation_system_destroy(system);
+        return false;
+    }
+
+    system->capacity = capacity;
+    return true;
+}
+
+sprite_animation_id_t sprite_animation_create(sprite_animation_system_ptr system, animation_clip_id_t clip,
+                                              uint32_t phase_offset_ms, timestamp_ms_t current_time) {
+    sprite_animation_id_t id;
+    if (system->free_count > 0) {
+        id = system->free_ids[--system->free_count];
+    } else if (system->used_slots < system->capacity) {
+        id = (sprite_animation_id_t)system->used_slots++;
+    } else {
+        return SPRITE_ANIMATION_NONE; // Table is full
+    }
+
+    system->phase_offsets_ms[id] = phase_offset_ms;
+    sprite_animation_play(system, id, clip, current_time);
+    return id;
+}
+
+void sprite_animation_play(sprite_animation_system_ptr system, sprite_animation_id_t id, animation_clip_id_t clip,
+                           timestamp_ms_t current_time) {
+    if (id == SPRITE_ANIMATION_NONE) {
+        return;
+    }
+
+    system->clips[id] = (uint8_t)clip;
+    system->start_times[id] = current_time;
+
+    // Valid right away, before the next update pass
+    const animation_clip_t *played = &ANIMATION_CLIPS[clip];
+    uint32_t frame = system->phase_offsets_ms[id] / (uint32_t)played->frame_duration_ms;
+    system->frames[id] = &played->frames[frame % (uint32_t)played->frame_count];
+}
+
+void sprite_animation_release(sprite_animation_system_ptr system, sprite_animation_id_t id) {
+    if (id == SPRITE_ANIMATION_NONE) {
+        return;
+    }
+
+    system->free_ids[system->free_count++] = id;
+}
+
+void sprite_animation_update(sprite_animation_system_ptr system, timestamp_ms_t current_time) {
+    // Released slots below used_slots are advanced too; that is cheaper than testing for them
+    for (size_t i = 0; i < system->used_slots; i++) {
+        animation_clip_id_t clip_id = (animation_clip_id_t)system->clips[i];
+        const animation_clip_t *clip = &ANIMATION_CLIPS[clip_id];
+
+        uint64_t elapsed = (uint64_t)(current_time - system->start_times[i]) + system->phase_offsets_ms[i];
+        uint64_t frame = elapsed / (uint64_t)clip->frame_duration_ms;
+
+        if (frame >= (uint64_t)clip->frame_count) {
+            if (clip->next_clip != clip_id) {
+                // One-shot finished: the follow-up clip starts now
+                system->clips[i] = (uint8_t)clip->next_clip;
+                system->start_times[i] = current_time;
+                clip = &ANIMATION_CLIPS[clip->next_clip];
+                frame = system->phase_offsets_ms[i] / (uint32_t)clip->frame_duration_ms;
+            }
+            frame %= (uint64_t)clip->frame_count;
+        }
+
+        system->frames[i] = &clip->frames[frame];
+    }
+}
+
+void sprite_animation_system_reset(sprite_animation_system_ptr system) {
+    system->free_count = 0;
+    system->used_slots = 0;
+}
+
+void sprite_animation_system_destroy(sprite_animation_system_ptr system) {
+    free(system->clips);
+    free(system->start_times);
+    free(system->phase_offsets_ms);
+    free(system->frames);
+    free(system->free_ids);
+    memset(system, 0, sizeof(*system));
+}
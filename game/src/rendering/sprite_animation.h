@@ -0,0 +1,124 @@
+/**
+ * @file sprite_animation.h
+ * @brief Centralized sprite animation component
+ *
+ * Every animated sprite owns one slot in a structure-of-arrays table: the
+ * clip it plays, when the clip started and a phase offset. A single pass
+ * per tick turns those into the current frame for every slot from one tick
+ * time, so entities never track animation timers themselves; they only
+ * switch clips on state changes and render code reads the current frame.
+ * One-shot clips (next_clip differs from the clip) hand over to their
+ * follow-up clip when they finish.
+ */
+
+#ifndef SPRITE_ANIMATION_H
+#define SPRITE_ANIMATION_H
+
+#include "sprite_atlas.h"
+#include "types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Id value that never refers to an animation
+#define SPRITE_ANIMATION_NONE (-1)
+
+// Animation slot identifier
+typedef int sprite_animation_id_t;
+
+/**
+ * Sprite animation table (structure of arrays, one entry per slot)
+ */
+typedef struct {
+    uint8_t *clips;                  // Clip playing in each slot (animation_clip_id_t)
+    timestamp_ms_t *start_times;     // When the clip started
+    uint32_t *phase_offsets_ms;      // Added to the elapsed time to stagger group members
+    const sprite_rect_t **frames;    // Current frame, refreshed by sprite_animation_update
+    sprite_animation_id_t *free_ids; // Stack of released slots below used_slots
+    size_t free_count;               // Number of entries in free_ids
+    size_t used_slots;               // Slots at or above this index have never been handed out
+    size_t capacity;                 // Maximum number of animations
+} sprite_animation_system_t;
+
+// Pointer typedef for sprite animation system
+typedef sprite_animation_system_t *sprite_animation_system_ptr;
+
+/**
+ * @brief Allocate an animation table
+ * @param system Animation system to initialize
+ * @param capacity Maximum number of simultaneous animations
+ * @return true if successful
+ */
+bool sprite_animation_system_init(sprite_animation_system_ptr system, size_t capacity);
+
+/**
+ * @brief Start a new animation
+ * @param system Animation system
+ * @param clip Clip to play
+ * @param phase_offset_ms Time the clip is advanced by (staggers members of a group)
+ * @param current_time Current game time
+ * @return Animation id, SPRITE_ANIMATION_NONE if the table is full
+ */
+sprite_animation_id_t sprite_animation_create(sprite_animation_system_ptr system, animation_clip_id_t clip,
+                                              uint32_t phase_offset_ms, timestamp_ms_t current_time);
+
+/**
+ * @brief Switch an animation to a clip, restarting it from its first frame
+ * @param system Animation system
+ * @param id Animation id (SPRITE_ANIMATION_NONE is ignored)
+ * @param clip Clip to play
+ * @param current_time Current game time
+ */
+void sprite_animation_play(sprite_animation_system_ptr system, sprite_animation_id_t id, animation_clip_id_t clip,
+                           timestamp_ms_t current_time);
+
+/**
+ * @brief Return an animation slot to the table
+ * @param system Animation system
+ * @param id Animation id (SPRITE_ANIMATION_NONE is ignored)
+ */
+void sprite_animation_release(sprite_animation_system_ptr system, sprite_animation_id_t id);
+
+/**
+ * @brief Advance every animation to the given time in one pass
+ * @param system Animation system
+ * @param current_time Current game time
+ */
+void sprite_animation_update(sprite_animation_system_ptr system, timestamp_ms_t current_time);
+
+/**
+ * @brief Release every animation at once
+ * @param system Animation system
+ */
+void sprite_animation_system_reset(sprite_animation_system_ptr system);
+
+/**
+ * @brief Free the memory owned by the animation table
+ * @param system Animation system
+ */
+void sprite_animation_system_destroy(sprite_animation_system_ptr system);
+
+/**
+ * @brief Current frame of an animation
+ * @param system Animation system
+ * @param id Animation id
+ * @return Sprite rectangle to draw, NULL for SPRITE_ANIMATION_NONE
+ */
+static inline const sprite_rect_t *sprite_animation_frame(const sprite_animation_system_t *system,
+                                                          sprite_animation_id_t id) {
+    return id == SPRITE_ANIMATION_NONE ? NULL : system->frames[id];
+}
+
+/**
+ * @brief Clip an animation is currently playing
+ * @param system Animation system
+ * @param id Animation id
+ * @return Clip description (facing, baseline); for SPRITE_ANIMATION_NONE an empty clip, never mirrored or aligned
+ */
+static inline const animation_clip_t *sprite_animation_clip(const sprite_animation_system_t *system,
+                                                            sprite_animation_id_t id) {
+    static const animation_clip_t no_clip = {NULL, 0, 0, ANIMATION_CLIP_COUNT, SPRITE_FACING_NONE, 0};
+    return id == SPRITE_ANIMATION_NONE ? &no_clip : &ANIMATION_CLIPS[system->clips[id]];
+}
+
+#endif // SPRITE_ANIMATION_H
@@ -1,33 +1,28 @@
 /**
  * @file sprite_atlas.c
- * @brief Sprite atlas coordinates and metadata implementation
+ * @brief Sprite atlas metadata implementation
+ *
+ * The sprite rectangles themselves are generated into sprite_atlas_rects.c.
  */
 
 #include "sprite_atlas.h"
 
-// Duck sprites
-const sprite_rect_t SPRITE_DUCK_NORMAL = {22, 12, 14, 11};  // Duck pointing left
-const sprite_rect_t SPRITE_DUCK_SHOOTING = {42, 9, 11, 14}; // Duck shooting right
-const sprite_rect_t SPRITE_DUCK_DEAD = {54, 78, 17, 10};    // Dead duck
+#include "crab.h"
+#include "duck.h"
+#include "jellyfish.h"
 
-// Popcorn sprite
-const sprite_rect_t SPRITE_POPCORN = {62, 14, 4, 4};
-
-// Crab sprites
-const sprite_rect_t SPRITE_CRAB_NORMAL = {14, 30, 17, 15};     // Normal crab
-const sprite_rect_t SPRITE_CRAB_WITH_BRICK = {56, 30, 16, 15}; // Crab carrying brick
-const sprite_rect_t SPRITE_CRAB_DROPPING = {36, 30, 13, 14};   // Crab dropping brick
-
-// Brick sprite
-const sprite_rect_t SPRITE_BRICK = {58, 30, 11, 4};
-
-// Jellyfish animation frames
-const sprite_rect_t SPRITE_JELLYFISH_FRAMES[4] = {
-    {80, 34, 12, 10},  // Frame 0
-    {80, 54, 12, 11},  // Frame 1
-    {106, 34, 12, 10}, // Frame 2
-    {106, 54, 12, 11}  // Frame 3
+// Animation clips (single-frame clips hold one pose; one-shots hand over to next_clip when done)
+const animation_clip_t ANIMATION_CLIPS[ANIMATION_CLIP_COUNT] = {
+    [ANIMATION_CLIP_DUCK_IDLE] = {&SPRITE_DUCK_NORMAL, 1, 1000, ANIMATION_CLIP_DUCK_IDLE, SPRITE_FACING_LEFT, 0},
+    [ANIMATION_CLIP_DUCK_SHOOTING] = {&SPRITE_DUCK_SHOOTING, 1, DUCK_SHOOT_DURATION, ANIMATION_CLIP_DUCK_IDLE,
+                                      SPRITE_FACING_RIGHT, 11}, // Baseline of SPRITE_DUCK_NORMAL
+    [ANIMATION_CLIP_DUCK_DEAD] = {&SPRITE_DUCK_DEAD, 1, DUCK_RESPAWN_DELAY, ANIMATION_CLIP_DUCK_IDLE,
+                                  SPRITE_FACING_NONE, 0},
+    [ANIMATION_CLIP_CRAB_WALK] = {&SPRITE_CRAB_NORMAL, 1, 1000, ANIMATION_CLIP_CRAB_WALK, SPRITE_FACING_NONE, 0},
+    [ANIMATION_CLIP_CRAB_CARRY] = {&SPRITE_CRAB_WITH_BRICK, 1, 1000, ANIMATION_CLIP_CRAB_CARRY, SPRITE_FACING_NONE,
+                                   0},
+    [ANIMATION_CLIP_CRAB_DROP] = {&SPRITE_CRAB_DROPPING, 1, DROP_ANIM_DURATION, ANIMATION_CLIP_CRAB_WALK,
+                                  SPRITE_FACING_NONE, 0},
+    [ANIMATION_CLIP_JELLYFISH_SWIM] = {SPRITE_JELLYFISH_FRAMES, JELLYFISH_FRAME_COUNT, ANIMATION_CYCLE_MS,
+                                       ANIMATION_CLIP_JELLYFISH_SWIM, SPRITE_FACING_NONE, 0},
 };
-
-// Heart sprite for lives
-const sprite_rect_t SPRITE_HEART = {78, 0, 8, 7};
@@ -2,7 +2,10 @@
  * @file sprite_atlas.h
  * @brief Sprite atlas coordinates and metadata
  *
- * Contains all sprite sheet coordinates and dimensions for game entities.
+ * Declares the rectangles of every game sprite in the packed sprite atlas,
+ * and the animation clips built from them. The rectangles are generated
+ * with the atlas by game/tools/atlas_packer.c (sprite_atlas_rects.c); the
+ * clips are written by hand in sprite_atlas.c.
  */
 
 #ifndef SPRITE_ATLAS_H
@@ -10,9 +13,15 @@
 
 /**
  * Sprite rectangle definition
+ *
+ * x, y, w and h are the sprite's opaque pixels in the atlas. The packer
+ * trims transparent borders away, so the sprite is drawn offset by the
+ * trim and laid out by its untrimmed source size.
  */
 typedef struct {
     int x, y, w, h;
+    int offset_x, offset_y; // Trimmed columns left of and rows above the packed pixels
+    int source_w, source_h; // Untrimmed size, for layout
 } sprite_rect_t;
 
 // Duck sprites
@@ -34,7 +43,38 @@ extern const sprite_rect_t SPRITE_BRICK;
 // Jellyfish animation frames (4 frames)
 extern const sprite_rect_t SPRITE_JELLYFISH_FRAMES[4];
 
-// Heart sprite for lives
-extern const sprite_rect_t SPRITE_HEART;
+/**
+ * Direction the frames of a clip face, used to decide when to mirror them
+ */
+typedef enum { SPRITE_FACING_NONE, SPRITE_FACING_LEFT, SPRITE_FACING_RIGHT } sprite_facing_t;
+
+/**
+ * Animation clip identifiers (index into ANIMATION_CLIPS)
+ */
+typedef enum {
+    ANIMATION_CLIP_DUCK_IDLE,
+    ANIMATION_CLIP_DUCK_SHOOTING,
+    ANIMATION_CLIP_DUCK_DEAD,
+    ANIMATION_CLIP_CRAB_WALK,
+    ANIMATION_CLIP_CRAB_CARRY,
+    ANIMATION_CLIP_CRAB_DROP,
+    ANIMATION_CLIP_JELLYFISH_SWIM,
+    ANIMATION_CLIP_COUNT
+} animation_clip_id_t;
+
+/**
+ * Animation clip: a frame sequence shown at a fixed rate
+ */
+typedef struct {
+    const sprite_rect_t *frames;   // Frame sequence
+    int frame_count;               // Number of frames
+    int frame_duration_ms;         // Time each frame is shown
+    animation_clip_id_t next_clip; // Clip that follows one pass (the clip itself to loop)
+    sprite_facing_t facing;        // Direction the frames face (NONE = never mirrored)
+    int baseline_height;           // Bottom-align frames to this source height (0 = top-aligned)
+} animation_clip_t;
+
+// Clip table
+extern const animation_clip_t ANIMATION_CLIPS[ANIMATION_CLIP_COUNT];
 
 #endif // SPRITE_ATLAS_H
@@ -0,0 +1,33 @@
+/**
+ * @file sprite_atlas_rects.c
+ * @brief Sprite rectangles in the packed 64x64 sprite atlas
+ *
+ * Generated by atlas_packer from game/assets/sprites/atlas.txt
+ * (`make atlas`); edit the manifest, not this file.
+ */
+
+#include "sprite_atlas.h"
+
+// Duck sprites
+const sprite_rect_t SPRITE_DUCK_NORMAL = {47, 0, 14, 11, 0, 0, 14, 11};   // Duck pointing left
+const sprite_rect_t SPRITE_DUCK_SHOOTING = {17, 0, 11, 14, 0, 0, 11, 14}; // Duck shooting right
+const sprite_rect_t SPRITE_DUCK_DEAD = {26, 16, 17, 10, 0, 0, 17, 10};    // Dead duck
+
+// Popcorn sprite
+const sprite_rect_t SPRITE_POPCORN = {39, 28, 4, 4, 0, 0, 4, 4};
+
+// Crab sprites
+const sprite_rect_t SPRITE_CRAB_NORMAL = {29, 0, 17, 12, 0, 2, 17, 15};    // Normal crab
+const sprite_rect_t SPRITE_CRAB_WITH_BRICK = {0, 0, 16, 15, 0, 0, 16, 15}; // Crab carrying brick
+const sprite_rect_t SPRITE_CRAB_DROPPING = {13, 28, 13, 8, 0, 6, 13, 14};  // Crab dropping brick
+
+// Brick sprite
+const sprite_rect_t SPRITE_BRICK = {27, 28, 11, 4, 0, 0, 11, 4};
+
+// Jellyfish animation frames
+const sprite_rect_t SPRITE_JELLYFISH_FRAMES[4] = {
+    {44, 16, 12, 10, 0, 0, 12, 10}, // Frame 0
+    {0, 16, 12, 11, 0, 0, 12, 11},  // Frame 1
+    {0, 28, 12, 10, 0, 0, 12, 10},  // Frame 2
+    {13, 16, 12, 11, 0, 0, 12, 11}  // Frame 3
+};
@@ -0,0 +1,138 @@
+/**
+ * @file sprite_batch.c
+ * @brief Batched textured quad renderer implementation
+ */
+
+#include "sprite_batch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static void submit_bucket(sprite_batch_ptr batch, sprite_batch_bucket_t *bucket) {
+    if (bucket->quad_count == 0) {
+        return;
+    }
+
+    SDL_RenderGeometry(batch->graphics_context->renderer, bucket->texture->texture, bucket->vertices,
+                       (int)(bucket->quad_count * 4), batch->indices, (int)(bucket->quad_count * 6));
+    batch->draw_calls++;
+    batch->quads_drawn += bucket->quad_count;
+    bucket->quad_count = 0;
+}
+
+// Bucket bound to a texture, binding a free one (after flushing them all if none is left)
+static sprite_batch_bucket_t *bucket_for(sprite_batch_ptr batch, const texture_t *texture) {
+    for (int i = 0; i < batch->bucket_count; i++) {
+        if (batch->buckets[i].texture == texture) {
+            return &batch->buckets[i];
+        }
+    }
+
+    if (batch->bucket_count == SPRITE_BATCH_MAX_TEXTURES) {
+        sprite_batch_flush(batch);
+    }
+
+    sprite_batch_bucket_t *bucket = &batch->buckets[batch->bucket_count++];
+    bucket->texture = texture;
+    return bucket;
+}
+
+bool sprite_batch_init(sprite_batch_ptr batch, size_t capacity) {
+    memset(batch, 0, sizeof(*batch));
+
+    if (capacity == 0) {
+        return false;
+    }
+
+    batch->indices = malloc(capacity * 6 * sizeof(int));
+    bool allocated = batch->indices != NULL;
+    for (int i = 0; i < SPRITE_BATCH_MAX_TEXTURES; i++) {
+        batch->buckets[i].vertices = malloc(capacity * 4 * sizeof(SDL_Vertex));
+        allocated = allocated && batch->buckets[i].vertices != NULL;
+    }
+    if (!allocated) {
+        sprite_batch_destroy(batch);
+        return false;
+    }
+
+    // Every quad is two triangles over its four corners; only the corners change per sprite
+    for (size_t i = 0; i < capacity; i++) {
+        int corner = (int)(i * 4);
+        int *quad = &batch->indices[i * 6];
+        quad[0] = corner;
+        quad[1] = corner + 1;
+        quad[2] = corner + 2;
+        quad[3] = corner + 2;
+        quad[4] = corner + 3;
+        quad[5] = corner;
+    }
+
+    batch->capacity = capacity;
+    return true;
+}
+
+void sprite_batch_begin(sprite_batch_ptr batch, graphics_context_t *graphics_context) {
+    batch->graphics_context = graphics_context;
+    batch->bucket_count = 0;
+    batch->draw_calls = 0;
+    batch->quads_drawn = 0;
+}
+
+void sprite_batch_draw(sprite_batch_ptr batch, const texture_t *texture, const sprite_rect_t *source, int x, int y,
+                       int width, int height, flip_t flip) {
+    if (!texture->texture || texture->width <= 0 || texture->height <= 0) {
+        return;
+    }
+
+    sprite_batch_bucket_t *bucket = bucket_for(batch, texture);
+    if (bucket->quad_count == batch->capacity) {
+        submit_bucket(batch, bucket);
+    }
+
+    float inverse_width = 1.0f / (float)texture->width;
+    float inverse_height = 1.0f / (float)texture->height;
+    float u0 = (float)source->x * inverse_width;
+    float v0 = (float)source->y * inverse_height;
+    float u1 = (float)(source->x + source->w) * inverse_width;
+    float v1 = (float)(source->y + source->h) * inverse_height;
+
+    // Mirroring only swaps which edge of the source each corner samples
+    if (flip == FLIP_HORIZONTAL) {
+        float u = u0;
+        u0 = u1;
+        u1 = u;
+    } else if (flip == FLIP_VERTICAL) {
+        float v = v0;
+        v0 = v1;
+        v1 = v;
+    }
+
+    float left = (float)x;
+    float top = (float)y;
+    float right = (float)(x + width);
+    float bottom = (float)(y + height);
+    const SDL_Color white = {255, 255, 255, 255};
+
+    SDL_Vertex *corner = &bucket->vertices[bucket->quad_count * 4];
+    corner[0] = (SDL_Vertex){{left, top}, white, {u0, v0}};
+    corner[1] = (SDL_Vertex){{right, top}, white, {u1, v0}};
+    corner[2] = (SDL_Vertex){{right, bottom}, white, {u1, v1}};
+    corner[3] = (SDL_Vertex){{left, bottom}, white, {u0, v1}};
+    bucket->quad_count++;
+}
+
+void sprite_batch_flush(sprite_batch_ptr batch) {
+    for (int i = 0; i < batch->bucket_count; i++) {
+        submit_bucket(batch, &batch->buckets[i]);
+        batch->buckets[i].texture = NULL;
+    }
+    batch->bucket_count = 0;
+}
+
+void sprite_batch_destroy(sprite_batch_ptr batch) {
+    free(batch->indices);
+    for (int i = 0; i < SPRITE_BATCH_MAX_TEXTURES; i++) {
+        free(batch->buckets[i].vertices);
+    }
+    memset(batch, 0, sizeof(*batch));
+}
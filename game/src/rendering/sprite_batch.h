@@ -0,0 +1,108 @@
+/**
+ * @file sprite_batch.h
+ * @brief Batched textured quad renderer
+ *
+ * Sprites are appended as quads to a vertex buffer kept per texture, with
+ * flips applied by swapping texture coordinates, and each texture's quads
+ * are submitted with a single geometry call when the batch is flushed.
+ * The number of renderer calls per frame therefore depends on how many
+ * textures and flush points a frame has, not on how many sprites it draws.
+ *
+ * Quads are drawn in the order they were added within a texture; textures
+ * are drawn in the order they were first used. Flush before drawing
+ * anything that must appear between two groups of sprites.
+ */
+
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include "graphics.h"
+#include "sprite_atlas.h"
+#include "texture.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// Textures a batch can hold at once (further textures flush the batch first)
+#define SPRITE_BATCH_MAX_TEXTURES 4
+
+/**
+ * Quads queued for one texture
+ */
+typedef struct {
+    const texture_t *texture; // Texture the quads sample (NULL while the bucket is free)
+    SDL_Vertex *vertices;     // Four corners per quad
+    size_t quad_count;        // Quads queued since the last flush
+} sprite_batch_bucket_t;
+
+/**
+ * Sprite batch
+ */
+typedef struct {
+    sprite_batch_bucket_t buckets[SPRITE_BATCH_MAX_TEXTURES];
+    int bucket_count;                     // Buckets bound to a texture
+    int *indices;                         // Two triangles per quad, built once and shared by every bucket
+    size_t capacity;                      // Quads per bucket (a full bucket is submitted early)
+    graphics_context_t *graphics_context; // Context set by sprite_batch_begin
+    size_t draw_calls;                    // Geometry calls since sprite_batch_begin
+    size_t quads_drawn;                   // Quads submitted since sprite_batch_begin
+} sprite_batch_t;
+
+// Pointer typedef for sprite batch
+typedef sprite_batch_t *sprite_batch_ptr;
+
+/**
+ * @brief Allocate a sprite batch
+ * @param batch Sprite batch to initialize
+ * @param capacity Maximum quads queued per texture between flushes
+ * @return true if successful
+ */
+bool sprite_batch_init(sprite_batch_ptr batch, size_t capacity);
+
+/**
+ * @brief Start a frame of batched drawing
+ * @param batch Sprite batch
+ * @param graphics_context Graphics context the batch submits to
+ */
+void sprite_batch_begin(sprite_batch_ptr batch, graphics_context_t *graphics_context);
+
+/**
+ * @brief Queue a sprite
+ * @param batch Sprite batch
+ * @param texture Texture holding the sprite
+ * @param source Sprite rectangle inside the texture
+ * @param x Destination left edge
+ * @param y Destination top edge
+ * @param width Destination width
+ * @param height Destination height
+ * @param flip Mirroring applied to the sprite
+ */
+void sprite_batch_draw(sprite_batch_ptr batch, const texture_t *texture, const sprite_rect_t *source, int x, int y,
+                       int width, int height, flip_t flip);
+
+/**
+ * @brief Queue a sprite drawn at a whole-number scale (like render_sprite_scaled)
+ * @param batch Sprite batch
+ * @param texture Texture holding the sprite
+ * @param source Sprite rectangle inside the texture
+ * @param x Destination left edge
+ * @param y Destination top edge
+ * @param scale Scale factor
+ */
+static inline void sprite_batch_draw_scaled(sprite_batch_ptr batch, const texture_t *texture,
+                                            const sprite_rect_t *source, int x, int y, int scale) {
+    sprite_batch_draw(batch, texture, source, x, y, source->w * scale, source->h * scale, FLIP_NONE);
+}
+
+/**
+ * @brief Submit every queued quad, one geometry call per texture
+ * @param batch Sprite batch
+ */
+void sprite_batch_flush(sprite_batch_ptr batch);
+
+/**
+ * @brief Free the memory owned by a sprite batch
+ * @param batch Sprite batch
+ */
+void sprite_batch_destroy(sprite_batch_ptr batch);
+
+#endif // SPRITE_BATCH_H
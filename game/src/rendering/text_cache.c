@@ -0,0 +1,89 @@
+/**
+ * @file text_cache.c
+ * @brief Bitmap font strings rendered once and reused implementation
+ */
+
+#include "text_cache.h"
+
+#include <string.h>
+
+static bool holds(const cached_text_t *cache, const char *text, font_color_t color, int scale) {
+    return cache->texture.texture && cache->scale == scale && cache->color == color &&
+           strncmp(cache->text, text, TEXT_CACHE_MAX_LENGTH - 1) == 0;
+}
+
+static bool reserve_target(cached_text_ptr cache, graphics_context_t *graphics_context, int width, int height) {
+    if (cache->texture.texture && cache->texture.width >= width && cache->texture.height >= height) {
+        return true;
+    }
+
+    if (cache->texture.texture) {
+        free_texture(&cache->texture);
+    }
+
+    SDL_Texture *texture = SDL_CreateTexture(graphics_context->renderer, SDL_PIXELFORMAT_RGBA8888,
+                                             SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!texture) {
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    cache->texture.texture = texture;
+    cache->texture.width = width;
+    cache->texture.height = height;
+    return true;
+}
+
+bool cached_text_update(cached_text_ptr cache, bitmap_font_t *font, graphics_context_t *graphics_context,
+                        const char *text, font_color_t color, int scale) {
+    if (holds(cache, text, color, scale)) {
+        return true;
+    }
+
+    char copy[TEXT_CACHE_MAX_LENGTH];
+    strncpy(copy, text, sizeof(copy) - 1);
+    copy[sizeof(copy) - 1] = '\0';
+
+    int width = get_bitmap_text_width_scaled(font, copy, scale);
+    int height = font->char_height * scale;
+    if (width <= 0 || height <= 0 || !reserve_target(cache, graphics_context, width, height)) {
+        cached_text_destroy(cache);
+        return false;
+    }
+
+    // Draw the glyphs once into the target, then put back whatever target was active
+    SDL_Renderer *renderer = graphics_context->renderer;
+    SDL_Texture *previous_target = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, cache->texture.texture) != 0) {
+        cached_text_destroy(cache);
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    render_bitmap_text_scaled(font, graphics_context, copy, 0, 0, color, scale);
+    SDL_SetRenderTarget(renderer, previous_target);
+
+    memcpy(cache->text, copy, sizeof(copy));
+    cache->color = color;
+    cache->scale = scale;
+    cache->width = width;
+    cache->height = height;
+    return true;
+}
+
+void cached_text_render(const cached_text_t *cache, graphics_context_t *graphics_context, int x, int y) {
+    if (!cache->texture.texture) {
+        return;
+    }
+
+    SDL_Rect source = {0, 0, cache->width, cache->height};
+    SDL_Rect destination = {x, y, cache->width, cache->height};
+    SDL_RenderCopy(graphics_context->renderer, cache->texture.texture, &source, &destination);
+}
+
+void cached_text_destroy(cached_text_ptr cache) {
+    if (cache->texture.texture) {
+        free_texture(&cache->texture);
+    }
+    memset(cache, 0, sizeof(*cache));
+}
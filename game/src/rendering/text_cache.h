@@ -0,0 +1,71 @@
+/**
+ * @file text_cache.h
+ * @brief Bitmap font strings rendered once and reused
+ *
+ * A cached text holds one string, already laid out and drawn glyph by glyph
+ * into a render target together with its measured size. Every later frame
+ * draws it with a single texture copy; the glyphs are drawn and measured
+ * again only when the string, its color or its scale changes.
+ */
+
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include "bitmap_font.h"
+#include "graphics.h"
+#include "texture.h"
+#include <stdbool.h>
+
+// Longest string a cached text can hold (including the terminator)
+#define TEXT_CACHE_MAX_LENGTH 64
+
+/**
+ * Cached string (zero-initialized means empty)
+ */
+typedef struct {
+    char text[TEXT_CACHE_MAX_LENGTH]; // String the texture currently holds
+    font_color_t color;               // Color it was drawn in
+    int scale;                        // Scale it was drawn at (0 while empty)
+    int width;                        // Width of the drawn string in pixels
+    int height;                       // Height of the drawn string in pixels
+    texture_t texture;                // Render target (grown when a longer string needs it)
+} cached_text_t;
+
+// Pointer typedef for cached text
+typedef cached_text_t *cached_text_ptr;
+
+/**
+ * @brief Make the cache hold a string, redrawing it only if the string, color or scale changed
+ * @param cache Cached text
+ * @param font Bitmap font
+ * @param graphics_context Graphics context owning the render target
+ * @param text String to hold (truncated to TEXT_CACHE_MAX_LENGTH - 1 characters)
+ * @param color Font color
+ * @param scale Font scale
+ * @return true if the cache holds the string
+ */
+bool cached_text_update(cached_text_ptr cache, bitmap_font_t *font, graphics_context_t *graphics_context,
+                        const char *text, font_color_t color, int scale);
+
+/**
+ * @brief Draw the cached string with one texture copy
+ * @param cache Cached text
+ * @param graphics_context Graphics context to draw into
+ * @param x Left edge
+ * @param y Top edge
+ */
+void cached_text_render(const cached_text_t *cache, graphics_context_t *graphics_context, int x, int y);
+
+/**
+ * @brief Forget what the render target holds, so the next update draws the string again
+ * @param cache Cached text
+ */
+static inline void cached_text_invalidate(cached_text_ptr cache) { cache->scale = 0; }
+
+/**
+ * @brief Free the render target and empty the cache
+ * @param cache Cached text
+ */
+void cached_text_destroy(cached_text_ptr cache);
+
+#endif // TEXT_CACHE_H
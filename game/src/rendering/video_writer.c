@@ -0,0 +1,135 @@
+/**
+ * @file video_writer.c
+ * @brief Background video frame writer implementation
+ */
+
+#include "video_writer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t *slot_pixels(video_writer_ptr writer, uint32_t index) {
+    return writer->slots + (size_t)(index & (VIDEO_WRITER_SLOTS - 1)) * writer->width * writer->height;
+}
+
+// BT.601 studio range, as y4m players assume
+static void convert_frame(video_writer_ptr writer, const uint32_t *pixels) {
+    size_t count = (size_t)writer->width * writer->height;
+    uint8_t *y_plane = writer->planes;
+    uint8_t *u_plane = y_plane + count;
+    uint8_t *v_plane = u_plane + count;
+
+    for (size_t i = 0; i < count; i++) {
+        int r = (int)(pixels[i] >> 16) & 0xFF;
+        int g = (int)(pixels[i] >> 8) & 0xFF;
+        int b = (int)pixels[i] & 0xFF;
+        y_plane[i] = (uint8_t)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+        u_plane[i] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+        v_plane[i] = (uint8_t)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+    }
+}
+
+static bool write_frame(video_writer_ptr writer, const uint32_t *pixels) {
+    convert_frame(writer, pixels);
+
+    // Full-resolution chroma (C444) keeps pixel art edges sharp
+    size_t plane_bytes = 3 * (size_t)writer->width * writer->height;
+    return fputs("FRAME\n", writer->file) >= 0 && fwrite(writer->planes, plane_bytes, 1, writer->file) == 1;
+}
+
+static int writer_thread(void *data) {
+    video_writer_ptr writer = (video_writer_ptr)data;
+
+    for (;;) {
+        // Read closing before head: once closing is seen, head already counts the last frame
+        bool closing = SDL_AtomicGet(&writer->closing) != 0;
+        uint32_t head = (uint32_t)SDL_AtomicGet(&writer->head);
+        uint32_t tail = (uint32_t)SDL_AtomicGet(&writer->tail);
+
+        if (head == tail) {
+            if (closing) {
+                break;
+            }
+            SDL_Delay(1);
+            continue;
+        }
+
+        // After a failed write the ring keeps draining, so the game thread never waits on a dead writer
+        if (!SDL_AtomicGet(&writer->failed) && !write_frame(writer, slot_pixels(writer, tail))) {
+            SDL_AtomicSet(&writer->failed, 1);
+        }
+        SDL_AtomicSet(&writer->tail, (int)(tail + 1));
+    }
+
+    return 0;
+}
+
+bool video_writer_open(video_writer_ptr writer, const char *path, int width, int height, int fps) {
+    memset(writer, 0, sizeof(*writer));
+
+    if (width <= 0 || height <= 0 || fps <= 0) {
+        return false;
+    }
+
+    size_t pixel_count = (size_t)width * height;
+    writer->width = width;
+    writer->height = height;
+    writer->slots = malloc(VIDEO_WRITER_SLOTS * pixel_count * sizeof(uint32_t));
+    writer->planes = malloc(3 * pixel_count);
+    writer->file = fopen(path, "wb");
+    if (!writer->slots || !writer->planes || !writer->file ||
+        fprintf(writer->file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", width, height, fps) < 0) {
+        printf("Failed to create video %s\n", path);
+        video_writer_close(writer);
+        return false;
+    }
+
+    writer->thread = SDL_CreateThread(writer_thread, "video_writer", writer);
+    if (!writer->thread) {
+        printf("Failed to start video writer thread: %s\n", SDL_GetError());
+        video_writer_close(writer);
+        return false;
+    }
+
+    return true;
+}
+
+void video_writer_push(video_writer_ptr writer, const soft_framebuffer_t *framebuffer) {
+    // Only this thread moves head; wait for the writer only if the ring is full
+    uint32_t head = (uint32_t)SDL_AtomicGet(&writer->head);
+    if (head - (uint32_t)SDL_AtomicGet(&writer->tail) == VIDEO_WRITER_SLOTS) {
+        writer->stalls++;
+        while (head - (uint32_t)SDL_AtomicGet(&writer->tail) == VIDEO_WRITER_SLOTS) {
+            SDL_Delay(1);
+        }
+    }
+
+    uint32_t *slot = slot_pixels(writer, head);
+    for (int row = 0; row < writer->height; row++) {
+        memcpy(slot + (size_t)row * writer->width, framebuffer->pixels + (size_t)row * framebuffer->pitch,
+               (size_t)writer->width * sizeof(uint32_t));
+    }
+
+    // Publish the slot only once its pixels are in place
+    SDL_AtomicSet(&writer->head, (int)(head + 1));
+}
+
+bool video_writer_close(video_writer_ptr writer) {
+    if (writer->thread) {
+        SDL_AtomicSet(&writer->closing, 1);
+        SDL_WaitThread(writer->thread, NULL);
+        writer->thread = NULL;
+    }
+
+    bool written = writer->file && !SDL_AtomicGet(&writer->failed);
+    if (writer->file && fclose(writer->file) != 0) {
+        written = false;
+    }
+    writer->file = NULL;
+
+    free(writer->slots);
+    free(writer->planes);
+    writer->slots = NULL;
+    writer->planes = NULL;
+    return written;
+}
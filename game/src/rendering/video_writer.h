@@ -0,0 +1,72 @@
+/**
+ * @file video_writer.h
+ * @brief Background writer for exported video frames
+ *
+ * The game thread copies each finished framebuffer into the next slot of a
+ * single-producer, single-consumer ring and moves on; a writer thread
+ * drains the ring, converts the frames to YUV and appends them to a
+ * YUV4MPEG2 (.y4m) file, which ffmpeg and most players read directly.
+ * The ring is lock-free: each side only advances its own index, published
+ * with atomic stores, so neither thread ever waits for the other while
+ * holding anything. The game thread only waits when the writer has fallen
+ * a whole ring behind, and that wait is counted.
+ */
+
+#ifndef VIDEO_WRITER_H
+#define VIDEO_WRITER_H
+
+#include "SDL.h"
+#include "soft_raster.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Frames the game can run ahead of the disk (a power of two)
+#define VIDEO_WRITER_SLOTS 32
+
+/**
+ * Video writer
+ */
+typedef struct {
+    uint32_t *slots;      // VIDEO_WRITER_SLOTS frames of width * height ARGB8888 pixels
+    int width;            // Frame width
+    int height;           // Frame height
+    SDL_atomic_t head;    // Frames queued (written by the game thread only)
+    SDL_atomic_t tail;    // Frames written (written by the writer thread only)
+    SDL_atomic_t closing; // No more frames will be queued
+    SDL_atomic_t failed;  // A write failed; remaining frames are dropped
+    FILE *file;           // Output file (used by the writer thread only)
+    uint8_t *planes;      // Y, U and V planes of the frame being written
+    SDL_Thread *thread;   // Writer thread
+    uint64_t stalls;      // Frames the game thread had to wait for a free slot
+} video_writer_t;
+
+// Pointer typedef for video writer
+typedef video_writer_t *video_writer_ptr;
+
+/**
+ * @brief Create the output file, write its header and start the writer thread
+ * @param writer Video writer to initialize
+ * @param path Output .y4m file
+ * @param width Frame width
+ * @param height Frame height
+ * @param fps Frame rate recorded in the header
+ * @return true if successful
+ */
+bool video_writer_open(video_writer_ptr writer, const char *path, int width, int height, int fps);
+
+/**
+ * @brief Queue a copy of a frame for writing
+ * @param writer Video writer
+ * @param framebuffer Finished frame (same size the writer was opened with)
+ */
+void video_writer_push(video_writer_ptr writer, const soft_framebuffer_t *framebuffer);
+
+/**
+ * @brief Write every queued frame, stop the writer thread and close the file
+ * @param writer Video writer
+ * @return true if every frame was written
+ */
+bool video_writer_close(video_writer_ptr writer);
+
+#endif // VIDEO_WRITER_H
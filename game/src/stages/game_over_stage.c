@@ -6,6 +6,7 @@
 #include "game_over_stage.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "bitmap_font.h"
 #include "clock.h"
@@ -13,6 +14,7 @@
 #include "events.h"
 #include "frame.h"
 #include "keyboard.h"
+#include "render_layer.h"
 
 // Forward declarations for stage callbacks
 static void game_over_init(stage_ptr stage, game_ptr game);
@@ -23,6 +25,7 @@ static void game_over_cleanup(stage_ptr stage);
 static void handle_input(game_over_stage_state_ptr state);
 static void update_scroll(game_over_stage_state_ptr state);
 static void render_game_over(game_over_stage_state_ptr state);
+static int game_over_target_y(void);
 
 stage_ptr create_game_over_stage_instance(void) {
     stage_ptr stage = (stage_ptr)malloc(sizeof(stage_t));
@@ -43,9 +46,12 @@ static void game_over_init(stage_ptr stage, game_ptr game) {
     if (!state)
         return;
 
+    memset(state, 0, sizeof(*state));
     state->game = game;
     state->game_over_y = LOGICAL_HEIGHT; // Start from bottom of screen
     state->start_time = get_clock_ticks_ms();
+    state->drawn_blink_phase = -1;
+    state->drawn_target_resets = SDL_AtomicGet(&game->render_target_resets);
 
     stage->state = state;
 }
@@ -62,6 +68,9 @@ static game_stage_action_t game_over_update(stage_ptr stage) {
 
 static void game_over_cleanup(stage_ptr stage) {
     if (stage->state) {
+        game_over_stage_state_ptr state = (game_over_stage_state_ptr)stage->state;
+        cached_text_destroy(&state->title_text);
+        cached_text_destroy(&state->restart_text);
         free(stage->state);
         stage->state = NULL;
     }
@@ -80,14 +89,22 @@ static void handle_input(game_over_stage_state_ptr state) {
 
     if (is_esc_key_pressed(keyboard_state)) {
         state->game->running = false;
+    } else if (is_space_key_pressed(keyboard_state) && state->game_over_y <= game_over_target_y()) {
+        // Only once the text has settled, so a held fire key doesn't skip the screen
+        state->game->sim_time = get_clock_ticks_ms();
+        game_restart(state->game);
     }
 }
 
-static void update_scroll(game_over_stage_state_ptr state) {
-    // Scroll GAME OVER text from bottom to center
+static int game_over_target_y(void) {
     const int text_scale = 5; // Large text
     const int text_height = 7 * text_scale;
-    const int target_y = (LOGICAL_HEIGHT - text_height) / 2; // Center vertically
+    return (LOGICAL_HEIGHT - text_height) / 2; // Center vertically
+}
+
+static void update_scroll(game_over_stage_state_ptr state) {
+    // Scroll GAME OVER text from bottom to center
+    const int target_y = game_over_target_y();
 
     if (state->game_over_y > target_y) {
         state->game_over_y -= 200.0f / FPS; // Scroll up 200 pixels per second
@@ -100,19 +117,46 @@ static void update_scroll(game_over_stage_state_ptr state) {
 static void render_game_over(game_over_stage_state_ptr state) {
     game_ptr game = state->game;
 
+    // Cached strings lost with a render-target reset are drawn again, and so is the frame
+    bool targets_lost = render_layer_targets_lost(&game->render_target_resets, &state->drawn_target_resets);
+    if (targets_lost) {
+        cached_text_invalidate(&state->title_text);
+        cached_text_invalidate(&state->restart_text);
+    }
+
+    // Once the text has settled only the prompt's blink changes the screen
+    bool settled = state->game_over_y <= game_over_target_y();
+    int blink_phase = -1;
+    if (settled) {
+        timestamp_ms_t current_time = get_clock_ticks_ms();
+        blink_phase = (elapsed_from(state->start_time) / PROMPT_BLINK_MS) % 2;
+        if (!frame_pacing_should_draw(&game->pacing, targets_lost || blink_phase != state->drawn_blink_phase)) {
+            frame_pacing_idle_until(&game->pacing,
+                                    frame_pacing_next_toggle(state->start_time, current_time, PROMPT_BLINK_MS));
+            return;
+        }
+    }
+    state->drawn_blink_phase = blink_phase;
+
     // Clear screen using engine
     clear_frame(&game->graphics_context);
 
-    // Render GAME OVER text scrolling from bottom to center
-    const char *game_over_text = "GAME OVER";
+    // Render GAME OVER text scrolling from bottom to center, in red letters (laid out once, then copied)
+    cached_text_update(&state->title_text, &game->font, &game->graphics_context, "GAME OVER", FONT_COLOR_RED, 1);
+
+    // Center horizontally
+    int text_x = (LOGICAL_WIDTH - state->title_text.width) / 2;
+    cached_text_render(&state->title_text, &game->graphics_context, text_x, (int)state->game_over_y);
 
-    // Calculate text width to center horizontally
-    int text_width = get_bitmap_text_width(&game->font, game_over_text);
-    int text_x = (LOGICAL_WIDTH - text_width) / 2;
+    // Offer an instant restart once the text has settled (blink every PROMPT_BLINK_MS)
+    if (settled && blink_phase == 0) {
+        cached_text_update(&state->restart_text, &game->font, &game->graphics_context, "PRESS SPACE TO PLAY AGAIN",
+                           FONT_COLOR_WHITE, 1);
+        int restart_x = (LOGICAL_WIDTH - state->restart_text.width) / 2;
+        int restart_y = (int)state->game_over_y + game->font.char_height * 2 + 20;
 
-    // Render in red letters
-    render_bitmap_text(&game->font, &game->graphics_context, game_over_text, text_x, (int)state->game_over_y,
-                       FONT_COLOR_RED);
+        cached_text_render(&state->restart_text, &game->graphics_context, restart_x, restart_y);
+    }
 
     // Present the rendered frame using engine
     render_frame(&game->graphics_context);
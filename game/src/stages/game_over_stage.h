@@ -13,14 +13,19 @@
 
 #include "game.h"
 #include "stage.h"
+#include "text_cache.h"
 
 /**
  * Game over stage state
  */
 typedef struct {
     game_ptr game;
-    float game_over_y;         // Y position of GAME OVER text
-    timestamp_ms_t start_time; // When stage started
+    float game_over_y;          // Y position of GAME OVER text
+    timestamp_ms_t start_time;  // When stage started
+    cached_text_t title_text;   // GAME OVER
+    cached_text_t restart_text; // Restart prompt
+    int drawn_blink_phase;      // Prompt phase on screen once settled (-1 while the text scrolls)
+    int drawn_target_resets;    // Render-target resets the cached strings were last drawn after
 } game_over_stage_state_t;
 
 typedef game_over_stage_state_t *game_over_stage_state_ptr;
@@ -0,0 +1,175 @@
+/**
+ * @file gameplay_simulation.c
+ * @brief One tick of gameplay implementation
+ */
+
+#include "gameplay_simulation.h"
+
+#include "brick.h"
+#include "collision_system.h"
+#include "constants.h"
+#include "crab.h"
+#include "duck.h"
+#include "jellyfish.h"
+#include "motion_dispatch.h"
+#include "popcorn.h"
+#include "wave_manager.h"
+
+// Helper functions
+static void process_motion_events(game_ptr game, timestamp_ms_t current_time);
+
+// Gameplay systems run by the update scheduler
+static void update_duck_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+static void release_popcorn_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+static void update_jellyfish_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+static void update_crabs_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+static void update_waves_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+static void release_bricks_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+static void update_animations_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+static void update_particles_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+
+void gameplay_simulation_init(gameplay_simulation_ptr simulation, game_ptr game) {
+    simulation->game = game;
+    simulation->crab_cursor = 0;
+
+    update_scheduler_ptr updates = &simulation->updates;
+    update_scheduler_init(updates);
+
+    // Movement the player sees and collides with runs every tick
+    update_scheduler_add(updates, "duck", UPDATE_EVERY_TICK, 1, update_duck_task, simulation);
+    update_scheduler_add(updates, "popcorn", UPDATE_EVERY_TICK, 1, release_popcorn_task, simulation);
+    update_scheduler_add(updates, "jellyfish", UPDATE_EVERY_TICK, 1, update_jellyfish_task, simulation);
+
+    // Crab upkeep (brick drops, releasing destroyed crabs) visits each crab at 15 Hz, a quarter per tick
+    update_scheduler_add_sliced(updates, "crabs", UPDATE_EVERY_4TH_TICK, 32, update_crabs_task, simulation);
+
+    // Bookkeeping that only has to keep up with human-scale timing
+    update_scheduler_add(updates, "waves", UPDATE_10_HZ, 4, update_waves_task, simulation);
+    update_scheduler_add(updates, "bricks", UPDATE_EVERY_4TH_TICK, 2, release_bricks_task, simulation);
+    update_scheduler_add(updates, "animations", UPDATE_EVERY_2ND_TICK, 8, update_animations_task, simulation);
+
+    // Particles move visibly every frame
+    update_scheduler_add(updates, "particles", UPDATE_EVERY_TICK, 8, update_particles_task, simulation);
+}
+
+bool gameplay_simulation_update(gameplay_simulation_ptr simulation) {
+    game_ptr game = simulation->game;
+    timestamp_ms_t current_time = game->sim_time;
+
+    // Check for game over (the caller switches screens, on the main thread)
+    if (game->lives <= 0) {
+        return false;
+    }
+
+    // Run every timer that came due (shooting pose, respawn, crab drops, brick timeouts, animation)
+    timer_wheel_advance(&game->timers, current_time);
+
+    // Step the simulation and handle the wraps, exits, landings and bounces predicted for this tick
+    game->sim_tick++;
+    process_motion_events(game, current_time);
+
+    // Every system due this tick, in registration order
+    update_scheduler_run(&simulation->updates, game->sim_tick, current_time);
+    return true;
+}
+
+bool gameplay_simulation_tick(gameplay_simulation_ptr simulation) {
+    bool playing = gameplay_simulation_update(simulation);
+    collision_system_update(simulation->game);
+    return playing;
+}
+
+static void process_motion_events(game_ptr game, timestamp_ms_t current_time) {
+    motion_dispatch_t dispatch = {&game->timers, &game->animations, &game->crabs_with_bricks, LOGICAL_WIDTH,
+                                  LAKE_START_Y};
+    motion_events_dispatch(&game->motion_events, &dispatch, game->sim_tick, current_time);
+}
+
+static void update_duck_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    (void)tick;
+    (void)current_time;
+    (void)divisor;
+    game_ptr game = ((gameplay_simulation_ptr)context)->game;
+
+    // Update duck state (only if alive)
+    if (!game->duck.dead) {
+        // Let duck_update handle movement and basic boundary checking
+        duck_update(&game->duck);
+
+        // Additional collision check with landed bricks after movement
+        if (collision_system_check_duck_landing(game, game->duck.x)) {
+            // If collision detected, undo the movement
+            game->duck.x -= game->duck.vx;
+            game->duck.vx = 0; // Stop duck movement
+        }
+    }
+}
+
+static void release_popcorn_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    (void)tick;
+    (void)current_time;
+    (void)divisor;
+    game_ptr game = ((gameplay_simulation_ptr)context)->game;
+
+    // Release spent popcorn (the fused collision pass does this itself)
+    if (!game->fused_popcorn_pass) {
+        popcorn_update_all(&game->popcorn_pool);
+    }
+}
+
+static void update_jellyfish_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    (void)current_time;
+    (void)divisor;
+    game_ptr game = ((gameplay_simulation_ptr)context)->game;
+
+    jellyfish_formation_update(&game->jellyfish_formation, tick);
+}
+
+static void update_crabs_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    gameplay_simulation_ptr simulation = (gameplay_simulation_ptr)context;
+    game_ptr game = simulation->game;
+
+    // Enough crabs to get through the whole population once every divisor ticks
+    size_t budget = (game->crab_pool.active_count + divisor - 1) / divisor;
+    crabs_update_slice(&game->crab_pool, &simulation->crab_cursor, budget, &game->brick_pool, &game->timers,
+                       &game->animations, &game->motion_events, &game->crabs_with_bricks, LOGICAL_WIDTH, LAKE_START_Y,
+                       tick, current_time, (void (*)(void *, int))play_sound, &game->audio_context);
+}
+
+static void update_waves_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    (void)divisor;
+    game_ptr game = ((gameplay_simulation_ptr)context)->game;
+
+    // Respawn destroyed crabs on schedule
+    wave_manager_update(&game->crab_waves, &game->crab_pool, &game->timers, &game->animations, &game->motion_events,
+                        tick, current_time);
+}
+
+static void release_bricks_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    (void)tick;
+    (void)current_time;
+    (void)divisor;
+    game_ptr game = ((gameplay_simulation_ptr)context)->game;
+
+    // Release expired bricks
+    bricks_update_all(&game->brick_pool, &game->timers);
+}
+
+static void update_animations_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    (void)tick;
+    (void)divisor;
+    game_ptr game = ((gameplay_simulation_ptr)context)->game;
+
+    // Frames are derived from the clock, so a lower rate only delays frame changes, never drifts
+    sprite_animation_update(&game->animations, current_time);
+}
+
+static void update_particles_task(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor) {
+    (void)tick;
+    (void)current_time;
+    (void)divisor;
+    game_ptr game = ((gameplay_simulation_ptr)context)->game;
+
+    // Move and fade hit sparks and feathers
+    particle_system_update(&game->particles);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file gameplay_simulation.h
+ * @brief One tick of gameplay, shared by the playing stage and the headless tools
+ *
+ * Owns the update scheduler and the gameplay systems registered with it
+ * (duck, popcorn, jellyfish, crab upkeep, waves, bricks, animations and
+ * particles), and steps them together with the predicted motion events,
+ * the timer wheel and the collision system. Nothing here renders, reads
+ * input or needs a window, so the state-hash check runs exactly the
+ * simulation the game runs.
+ */
+
+#ifndef GAME_SRC_STAGES_GAMEPLAY_SIMULATION_H_
+#define GAME_SRC_STAGES_GAMEPLAY_SIMULATION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "game.h"
+#include "update_scheduler.h"
+
+/**
+ * Gameplay simulation state
+ */
+typedef struct {
+    game_ptr game;
+    update_scheduler_t updates; // Gameplay systems and their update rates
+    size_t crab_cursor;         // Where the next slice of crab upkeep resumes
+} gameplay_simulation_t;
+
+typedef gameplay_simulation_t *gameplay_simulation_ptr;
+
+/**
+ * Register the gameplay systems for a game
+ *
+ * @param simulation Simulation to initialize
+ * @param game Game whose entities the systems update
+ */
+void gameplay_simulation_init(gameplay_simulation_ptr simulation, game_ptr game);
+
+/**
+ * Advance the clock-driven part of the game by one tick
+ *
+ * Runs the timers that came due at game->sim_time, the motion events
+ * predicted for the new tick and every system due on it. Collisions are
+ * not processed.
+ *
+ * @param simulation Simulation to step
+ * @return false once the game is over (no lives left), true otherwise
+ */
+bool gameplay_simulation_update(gameplay_simulation_ptr simulation);
+
+/**
+ * Run one full gameplay tick: gameplay_simulation_update, then collisions
+ *
+ * The caller sets game->sim_time and applies the player's input first.
+ *
+ * @param simulation Simulation to step
+ * @return false once the game is over (no lives left), true otherwise
+ */
+bool gameplay_simulation_tick(gameplay_simulation_ptr simulation);
+
+#endif // GAME_SRC_STAGES_GAMEPLAY_SIMULATION_H_
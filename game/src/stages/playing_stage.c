@@ -8,24 +8,23 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include "brick.h"
-#include "collision_system.h"
+#include "clock.h"
 #include "constants.h"
-#include "crab.h"
-#include "duck.h"
 #include "game_renderer.h"
-#include "jellyfish.h"
-#include "object_pool.h"
+#include "gameplay_simulation.h"
 #include "player_controller.h"
-#include "popcorn.h"
+#include "replay.h"
 
 // Forward declarations for stage callbacks
 static void playing_init(stage_ptr stage, game_ptr game);
 static game_stage_action_t playing_update(stage_ptr stage);
 static void playing_cleanup(stage_ptr stage);
 
-// Helper function
-static void update_gameplay(playing_stage_state_ptr state);
+// Helper functions
+static bool simulate_tick(playing_stage_state_ptr state);
+static int simulation_thread(void *data);
+static void stop_simulation(playing_stage_state_ptr state);
+static game_stage_action_t update_threaded(playing_stage_state_ptr state);
 
 stage_ptr create_playing_stage_instance(void) {
     stage_ptr stage = (stage_ptr)malloc(sizeof(stage_t));
@@ -47,77 +46,142 @@ static void playing_init(stage_ptr stage, game_ptr game) {
         return;
 
     state->game = game;
+    state->simulation = NULL;
+    SDL_AtomicSet(&state->input, 0);
+    SDL_AtomicSet(&state->stop, 0);
+    SDL_AtomicSet(&state->outcome, SIMULATION_RUNNING);
+    gameplay_simulation_init(&state->gameplay, game);
     stage->state = state;
+
+    // A recorded or replayed session starts from a fresh layout on the recording's seed and clock
+    if (replay_begin_session(&game->replay, get_clock_ticks_ms())) {
+        srand(game->replay.seed);
+        game->particles.random_state = game->replay.seed | 1u; // Same sparks too, for identical video frames
+        game->sim_time = game->replay.start_time;
+        game_restart(game);
+    }
+
+    // Snapshots left from the previous game must not be drawn before this one publishes its first
+    render_snapshot_buffer_reset(&game->snapshots);
+
+    if (game->simulation_thread) {
+        state->simulation = SDL_CreateThread(simulation_thread, "simulation", state);
+        if (!state->simulation) {
+            printf("Failed to start simulation thread, simulating on the main thread: %s\n", SDL_GetError());
+        }
+    }
 }
 
 static game_stage_action_t playing_update(stage_ptr stage) {
     playing_stage_state_ptr state = (playing_stage_state_ptr)stage->state;
 
+    if (state->simulation) {
+        return update_threaded(state);
+    }
+
     // Handle player input
     if (!player_process_input(state->game)) {
         state->game->running = false;
         return PROGRESS;
     }
 
-    // Update game logic
-    update_gameplay(state);
-
-    // Process collisions
-    collision_system_update(state->game);
+    // Update game logic, process collisions and snapshot the result
+    bool playing = simulate_tick(state);
 
     // Render the game
-    render_game(state->game);
+    render_game_present(state->game);
 
+    if (!playing) {
+        state->game->current_screen = SCREEN_GAME_OVER;
+    }
     return PROGRESS;
 }
 
-static void playing_cleanup(stage_ptr stage) {
-    if (stage->state) {
-        free(stage->state);
-        stage->state = NULL;
+// Main thread while the simulation runs on its own: forward the keys, present, follow the simulation's end
+static game_stage_action_t update_threaded(playing_stage_state_ptr state) {
+    game_ptr game = state->game;
+
+    uint8_t input = 0;
+    if (!player_poll_input(game, &input)) {
+        stop_simulation(state);
+        game->running = false;
+        return PROGRESS;
+    }
+    SDL_AtomicSet(&state->input, input);
+
+    // Blocks on vsync without holding up the simulation
+    render_game_present(game);
+
+    simulation_outcome_t outcome = (simulation_outcome_t)SDL_AtomicGet(&state->outcome);
+    if (outcome != SIMULATION_RUNNING) {
+        stop_simulation(state);
+        if (outcome == SIMULATION_GAME_OVER) {
+            game->current_screen = SCREEN_GAME_OVER;
+        } else {
+            game->running = false;
+        }
     }
+    return PROGRESS;
 }
 
-static void update_gameplay(playing_stage_state_ptr state) {
+// One tick of gameplay, collisions and the snapshot the renderer draws; false once the game is over
+static bool simulate_tick(playing_stage_state_ptr state) {
+    bool playing = gameplay_simulation_tick(&state->gameplay);
+    render_game_capture(state->game);
+    return playing;
+}
+
+static int simulation_thread(void *data) {
+    playing_stage_state_ptr state = (playing_stage_state_ptr)data;
     game_ptr game = state->game;
-    timestamp_ms_t current_time = get_clock_ticks_ms();
+    timestamp_ms_t next_tick = get_clock_ticks_ms();
+
+    while (!SDL_AtomicGet(&state->stop)) {
+        // Nothing moves while the window is out of sight, as when the stage itself is not updated
+        if (SDL_AtomicGet(&game->simulation_paused)) {
+            SDL_Delay(FRAME_DELAY);
+            next_tick = get_clock_ticks_ms();
+            continue;
+        }
 
-    // Check for game over
-    if (game->lives <= 0) {
-        game->current_screen = SCREEN_GAME_OVER;
-        return;
-    }
+        if (!player_step_input(game, (uint8_t)SDL_AtomicGet(&state->input))) {
+            SDL_AtomicSet(&state->outcome, SIMULATION_REPLAY_ENDED);
+            break;
+        }
+        if (!simulate_tick(state)) {
+            SDL_AtomicSet(&state->outcome, SIMULATION_GAME_OVER);
+            break;
+        }
 
-    // Handle duck respawn after death (2 seconds delay)
-    if (game->duck.dead) {
-        if (current_time - game->duck.death_time >= 2000) {
-            duck_respawn(&game->duck, LOGICAL_WIDTH / 2.0f, LAKE_START_Y - DUCK_HEIGHT);
+        // The simulation keeps its own fixed rate; how long presenting takes no longer matters to it
+        next_tick += FRAME_DELAY;
+        timestamp_ms_t now = get_clock_ticks_ms();
+        if (now < next_tick) {
+            SDL_Delay((uint32_t)(next_tick - now));
+        } else if (now - next_tick > SIMULATION_MAX_LAG_MS) {
+            next_tick = now; // Resume after a long stall instead of racing to catch up
         }
     }
 
-    // Update duck state (only if alive)
-    if (!game->duck.dead) {
-        // Let duck_update handle movement and basic boundary checking
-        duck_update(&game->duck);
+    return 0;
+}
 
-        // Additional collision check with landed bricks after movement
-        if (collision_system_check_duck_landing(game, game->duck.x)) {
-            // If collision detected, undo the movement
-            game->duck.x -= game->duck.vx;
-            game->duck.vx = 0; // Stop duck movement
-        }
+static void stop_simulation(playing_stage_state_ptr state) {
+    if (state->simulation) {
+        SDL_AtomicSet(&state->stop, 1);
+        SDL_WaitThread(state->simulation, NULL);
+        state->simulation = NULL;
     }
+}
 
-    // Update popcorn
-    popcorn_update_all(&game->popcorn_pool, LOGICAL_HEIGHT);
-
-    // Update jellyfish
-    jellyfish_update_all(&game->jellyfish_pool, LOGICAL_WIDTH, current_time);
+static void playing_cleanup(stage_ptr stage) {
+    if (stage->state) {
+        stop_simulation((playing_stage_state_ptr)stage->state);
 
-    // Update crabs
-    crabs_update_all(&game->crab_pool, &game->brick_pool, LOGICAL_WIDTH, current_time,
-                     (void (*)(void *, int))play_sound, &game->audio_context);
+        // A replay covers one session; the next game is live and unrecorded
+        replay_close(&((playing_stage_state_ptr)stage->state)->game->replay);
 
-    // Update bricks
-    bricks_update_all(&game->brick_pool, LAKE_START_Y, current_time);
+        free(stage->state);
+        stage->state = NULL;
+    }
 }
@@ -11,24 +11,40 @@
 
 #include <stdbool.h>
 
+#include "SDL.h"
 #include "game.h"
+#include "gameplay_simulation.h"
 #include "stage.h"
 
+// Longest the simulation thread falls behind its schedule before it stops catching up
+#define SIMULATION_MAX_LAG_MS 250
+
+/**
+ * How the simulation thread ended
+ */
+typedef enum {
+    SIMULATION_RUNNING,     // Still running (or never started)
+    SIMULATION_GAME_OVER,   // Out of lives
+    SIMULATION_REPLAY_ENDED // The replay being played back ran out
+} simulation_outcome_t;
+
 /**
  * Playing stage state
+ *
+ * With game->simulation_thread set, input, update and collisions run on a
+ * simulation thread at a fixed tick rate, each tick ending with a published
+ * render snapshot, while the main thread (which SDL requires for events and
+ * rendering) forwards the keys and presents the latest snapshot.
  */
 typedef struct {
     game_ptr game;
+    gameplay_simulation_t gameplay; // Gameplay systems, stepped once per tick
+    SDL_Thread *simulation;         // Simulation thread (NULL when the stage simulates on the main thread)
+    SDL_atomic_t input;             // Keys last read by the main thread (PLAYER_INPUT_* flags)
+    SDL_atomic_t stop;              // Set by the main thread to end the simulation thread
+    SDL_atomic_t outcome;           // simulation_outcome_t, set by the simulation thread as it ends
 } playing_stage_state_t;
 
 typedef playing_stage_state_t *playing_stage_state_ptr;
 
-/**
- * Handle playing stage logic (input, update, render)
- *
- * @param state Playing stage state
- * @return Stage action (PROGRESS or QUIT)
- */
-game_stage_action_t handle_playing_stage(playing_stage_state_ptr state);
-
 #endif // GAME_SRC_STAGES_PLAYING_STAGE_H_
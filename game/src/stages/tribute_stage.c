@@ -5,6 +5,7 @@
 
 #include "tribute_stage.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -14,12 +15,25 @@
 #include "events.h"
 #include "frame.h"
 #include "keyboard.h"
+#include "render_layer.h"
 
 // Tribute text lines
 static const char *TRIBUTE_LINES[] = {"THIS IS A TRIBUTE", "TO ED HODAPP", "WHO ORIGINALLY WROTE",
                                       "DEADLY DUCK IN 1982", "FOR SIRIUS SOFTWARE"};
 static const int NUM_TRIBUTE_LINES = 5;
 
+/**
+ * Placement of the credits block, worked out once per stage
+ */
+typedef struct {
+    int scale;        // Text scale fitting the longest line to 90% of the screen width
+    int line_height;  // Scaled character height plus spacing
+    int cover_y;      // Top of the cover inside the block
+    int cover_width;  // Cover width (90% of the screen width)
+    int cover_height; // Cover height keeping its aspect ratio
+    int height;       // Height of the whole block
+} credits_layout_t;
+
 // Forward declarations for stage callbacks
 static void tribute_init(stage_ptr stage, game_ptr game);
 static game_stage_action_t tribute_update(stage_ptr stage);
@@ -29,6 +43,9 @@ static void tribute_cleanup(stage_ptr stage);
 static void handle_input(tribute_stage_state_ptr state);
 static void update_scroll(tribute_stage_state_ptr state);
 static void render_tribute(tribute_stage_state_ptr state);
+static void layout_credits(game_ptr game, credits_layout_t *layout);
+static void draw_credits(game_ptr game, const credits_layout_t *layout);
+static void bake_credits(tribute_stage_state_ptr state);
 
 stage_ptr create_tribute_stage_instance(void) {
     stage_ptr stage = (stage_ptr)malloc(sizeof(stage_t));
@@ -49,10 +66,14 @@ static void tribute_init(stage_ptr stage, game_ptr game) {
     if (!state)
         return;
 
+    memset(state, 0, sizeof(*state));
     state->game = game;
     state->scroll_y = LOGICAL_HEIGHT; // Start from bottom of screen
     state->start_time = get_clock_ticks_ms();
     state->waiting_for_space = true; // Wait for space key before scrolling
+    state->drawn_blink_phase = -1;
+    state->drawn_target_resets = SDL_AtomicGet(&game->render_target_resets);
+    bake_credits(state);
 
     stage->state = state;
 }
@@ -69,6 +90,11 @@ static game_stage_action_t tribute_update(stage_ptr stage) {
 
 static void tribute_cleanup(stage_ptr stage) {
     if (stage->state) {
+        tribute_stage_state_ptr state = (tribute_stage_state_ptr)stage->state;
+        if (state->credits.texture) {
+            free_texture(&state->credits);
+        }
+        cached_text_destroy(&state->start_text);
         free(stage->state);
         stage->state = NULL;
     }
@@ -106,34 +132,18 @@ static void update_scroll(tribute_stage_state_ptr state) {
         state->scroll_y -= 100.0f / FPS;
     }
 
-    // After cover image scrolls completely off screen, move to game screen
-    // Calculate text height dynamically based on scale
-    int estimated_scale = 3; // Rough estimate
-    int text_height = NUM_TRIBUTE_LINES * (7 * estimated_scale + 5);
-    // Cover starts 50 pixels after text
-    float cover_start_y = state->scroll_y + text_height + 50;
-    // Cover is scaled to 90% of screen width, calculate height maintaining aspect ratio
-    int target_cover_width = (int)(LOGICAL_WIDTH * 0.9f);
-    float aspect_ratio = (float)state->game->cover_height / (float)state->game->cover_width;
-    float cover_scaled_height = target_cover_width * aspect_ratio;
-
-    // If bottom of cover has scrolled off top of screen, transition to game
-    if (cover_start_y + cover_scaled_height < 0) {
+    // Once the bottom of the cover has scrolled off the top of the screen, move to the game screen
+    if (state->scroll_y + state->credits_height < 0) {
         state->game->current_screen = SCREEN_GAME;
     }
 }
 
-static void render_tribute(tribute_stage_state_ptr state) {
-    game_ptr game = state->game;
-
-    // Clear screen using engine
-    clear_frame(&game->graphics_context);
-
+static void layout_credits(game_ptr game, credits_layout_t *layout) {
     // Find the longest line to calculate scale
     const char *longest_line = TRIBUTE_LINES[0];
-    int max_len = strlen(TRIBUTE_LINES[0]);
+    size_t max_len = strlen(TRIBUTE_LINES[0]);
     for (int i = 1; i < NUM_TRIBUTE_LINES; i++) {
-        int len = strlen(TRIBUTE_LINES[i]);
+        size_t len = strlen(TRIBUTE_LINES[i]);
         if (len > max_len) {
             max_len = len;
             longest_line = TRIBUTE_LINES[i];
@@ -143,14 +153,25 @@ static void render_tribute(tribute_stage_state_ptr state) {
     // Calculate scale so longest line takes 90% of screen width
     int target_width = (int)(LOGICAL_WIDTH * 0.9f);
     int unscaled_width = get_bitmap_text_width(&game->font, longest_line);
-    int scale = target_width / unscaled_width;
-    if (scale < 1)
-        scale = 1; // Minimum scale of 1
+    layout->scale = unscaled_width > 0 ? target_width / unscaled_width : 1;
+    if (layout->scale < 1)
+        layout->scale = 1; // Minimum scale of 1
+
+    layout->line_height = game->font.char_height * layout->scale + 5; // Character height * scale + spacing
+
+    // Cover 50 pixels after the text, scaled to 90% of screen width, maintaining aspect ratio
+    layout->cover_y = NUM_TRIBUTE_LINES * layout->line_height + 50;
+    layout->cover_width = (int)(LOGICAL_WIDTH * 0.9f);
+    float aspect_ratio = game->cover_width > 0 ? (float)game->cover_height / (float)game->cover_width : 0.0f;
+    layout->cover_height = (int)(layout->cover_width * aspect_ratio);
+    layout->height = layout->cover_y + layout->cover_height;
+}
 
-    int line_height = game->font.char_height * scale + 5; // Character height * scale + spacing
+static void draw_credits(game_ptr game, const credits_layout_t *layout) {
+    int scale = layout->scale;
 
     // Render each line centered
-    int current_y = (int)state->scroll_y;
+    int current_y = 0;
     for (int i = 0; i < NUM_TRIBUTE_LINES; i++) {
         if (i == 1) {
             // Line 2: "TO ED HODAPP" - render "TO " in yellow, "ED HODAPP" in pink
@@ -181,38 +202,106 @@ static void render_tribute(tribute_stage_state_ptr state) {
                                       FONT_COLOR_YELLOW, scale);
         }
 
-        current_y += line_height;
+        current_y += layout->line_height;
+    }
+
+    // The full-resolution cover is scaled once here instead of every frame
+    int cover_x = (LOGICAL_WIDTH - layout->cover_width) / 2;
+    rect_t dest_rect = make_rect(cover_x, layout->cover_y, layout->cover_width, layout->cover_height);
+    render_sprite(&game->graphics_context, &game->cover_image, NULL, &dest_rect);
+}
+
+static void bake_credits(tribute_stage_state_ptr state) {
+    game_ptr game = state->game;
+    SDL_Renderer *renderer = game->graphics_context.renderer;
+
+    // The end of the scroll is known exactly even if the texture can't be made
+    credits_layout_t layout;
+    layout_credits(game, &layout);
+    state->credits_height = layout.height;
+
+    // Baking again after a render-target reset replaces the texture
+    if (state->credits.texture) {
+        free_texture(&state->credits);
+    }
+
+    SDL_Texture *texture =
+        SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, LOGICAL_WIDTH, layout.height);
+    if (!texture) {
+        printf("Failed to create tribute credits texture\n");
+        return;
+    }
+
+    if (SDL_SetRenderTarget(renderer, texture) != 0) {
+        printf("Failed to draw tribute credits texture\n");
+        SDL_DestroyTexture(texture);
+        return;
+    }
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    draw_credits(game, &layout);
+    SDL_SetRenderTarget(renderer, NULL);
+
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    state->credits.texture = texture;
+    state->credits.width = LOGICAL_WIDTH;
+    state->credits.height = layout.height;
+}
+
+static void render_tribute(tribute_stage_state_ptr state) {
+    game_ptr game = state->game;
+
+    // The credits block and the prompt lost with a render-target reset are drawn again, and so is the frame
+    bool targets_lost = render_layer_targets_lost(&game->render_target_resets, &state->drawn_target_resets);
+    if (targets_lost) {
+        bake_credits(state);
+        cached_text_invalidate(&state->start_text);
+    }
+
+    // While waiting for space only the prompt's blink changes the screen
+    int blink_phase = -1;
+    if (state->waiting_for_space) {
+        timestamp_ms_t current_time = get_clock_ticks_ms();
+        blink_phase = (elapsed_from(state->start_time) / PROMPT_BLINK_MS) % 2;
+        if (!frame_pacing_should_draw(&game->pacing, targets_lost || blink_phase != state->drawn_blink_phase)) {
+            frame_pacing_idle_until(&game->pacing,
+                                    frame_pacing_next_toggle(state->start_time, current_time, PROMPT_BLINK_MS));
+            return;
+        }
+    }
+    state->drawn_blink_phase = blink_phase;
+
+    // Clear screen using engine
+    clear_frame(&game->graphics_context);
+
+    // Copy just the part of the credits block that is on screen
+    int credits_top = (int)state->scroll_y;
+    int visible_top = credits_top > 0 ? credits_top : 0;
+    int visible_bottom = credits_top + state->credits_height;
+    if (visible_bottom > LOGICAL_HEIGHT) {
+        visible_bottom = LOGICAL_HEIGHT;
+    }
+
+    if (state->credits.texture && visible_bottom > visible_top) {
+        SDL_Rect source = {0, visible_top - credits_top, LOGICAL_WIDTH, visible_bottom - visible_top};
+        SDL_Rect destination = {0, visible_top, LOGICAL_WIDTH, visible_bottom - visible_top};
+        SDL_RenderCopy(game->graphics_context.renderer, state->credits.texture, &source, &destination);
     }
 
     // Render "PRESS SPACE TO START" if waiting
     if (state->waiting_for_space) {
-        // Blink every 500ms
-        int elapsed = elapsed_from(state->start_time);
-        if ((elapsed / 500) % 2 == 0) {
-            const char *start_text = "PRESS SPACE TO START";
+        // Blink every PROMPT_BLINK_MS
+        if (blink_phase == 0) {
             int start_scale = 2; // Use a fixed scale for the prompt
-            int start_width = get_bitmap_text_width_scaled(&game->font, start_text, start_scale);
-            int start_x = (LOGICAL_WIDTH - start_width) / 2;
+            cached_text_update(&state->start_text, &game->font, &game->graphics_context, "PRESS SPACE TO START",
+                               FONT_COLOR_WHITE, start_scale);
+            int start_x = (LOGICAL_WIDTH - state->start_text.width) / 2;
             int start_y = LOGICAL_HEIGHT / 2;
 
-            render_bitmap_text_scaled(&game->font, &game->graphics_context, start_text, start_x, start_y,
-                                      FONT_COLOR_WHITE, start_scale);
+            cached_text_render(&state->start_text, &game->graphics_context, start_x, start_y);
         }
     }
 
-    // Render cover image 50 pixels after the text
-    int text_height = NUM_TRIBUTE_LINES * line_height;
-    int cover_y = (int)(state->scroll_y + text_height + 50);
-
-    // Scale cover to 90% of screen width, maintaining aspect ratio
-    int target_cover_width = (int)(LOGICAL_WIDTH * 0.9f);
-    float aspect_ratio = (float)game->cover_height / (float)game->cover_width;
-    int cover_scaled_height = (int)(target_cover_width * aspect_ratio);
-    int cover_x = (LOGICAL_WIDTH - target_cover_width) / 2;
-
-    rect_t dest_rect = make_rect(cover_x, cover_y, target_cover_width, cover_scaled_height);
-    render_sprite(&game->graphics_context, &game->cover_image, NULL, &dest_rect);
-
     // Present the rendered frame
     render_frame(&game->graphics_context);
 }
@@ -14,6 +14,7 @@
 
 #include "game.h"
 #include "stage.h"
+#include "text_cache.h"
 
 /**
  * Tribute stage state
@@ -23,6 +24,11 @@ typedef struct {
     float scroll_y;            // Current scroll position
     timestamp_ms_t start_time; // When stage started
     bool waiting_for_space;    // Waiting for user to press space
+    texture_t credits;         // Tribute text and cover, laid out once at stage init
+    int credits_height;        // Height of the credits block in pixels
+    cached_text_t start_text;  // Blinking start prompt
+    int drawn_blink_phase;     // Prompt phase on screen while waiting (-1 when nothing is drawn yet)
+    int drawn_target_resets;   // Render-target resets the credits and prompt were last drawn after
 } tribute_stage_state_t;
 
 typedef tribute_stage_state_t *tribute_stage_state_ptr;
@@ -0,0 +1,235 @@
+/**
+ * @file timer_wheel.c
+ * @brief Hierarchical timer wheel implementation
+ */
+
+#include "timer_wheel.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+#define HANDLE_INDEX_BITS 16
+#define HANDLE_INDEX_MASK ((1U << HANDLE_INDEX_BITS) - 1)
+
+static void list_init(timer_node_t *sentinel) {
+    sentinel->prev = sentinel;
+    sentinel->next = sentinel;
+}
+
+static void list_unlink(timer_node_t *node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->prev = node;
+    node->next = node;
+}
+
+static void list_append(timer_node_t *sentinel, timer_node_t *node) {
+    node->prev = sentinel->prev;
+    node->next = sentinel;
+    sentinel->prev->next = node;
+    sentinel->prev = node;
+}
+
+// Move every node of one list onto another (empty) sentinel
+static void list_take(timer_node_t *from, timer_node_t *to) {
+    if (from->next == from) {
+        list_init(to);
+        return;
+    }
+
+    to->next = from->next;
+    to->prev = from->prev;
+    to->next->prev = to;
+    to->prev->next = to;
+    list_init(from);
+}
+
+static uint64_t time_to_tick(timestamp_ms_t time) { return (uint64_t)time / TIMER_WHEEL_RESOLUTION_MS; }
+
+static void insert_node(timer_wheel_ptr wheel, timer_node_t *node) {
+    // Cascaded timers may be due on the current tick, whose level-0 slot is drained right after
+    uint64_t expires = node->expires_tick > wheel->current_tick ? node->expires_tick : wheel->current_tick;
+    uint64_t delta = expires - wheel->current_tick;
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= ((uint64_t)1 << (TIMER_WHEEL_SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+
+    // Deadlines beyond the top level park in its furthest slot and cascade again later
+    uint64_t top_span = (uint64_t)1 << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS);
+    if (delta >= top_span) {
+        expires = wheel->current_tick + top_span - 1;
+    }
+
+    size_t slot = (size_t)((expires >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK);
+    list_append(&wheel->slots[level][slot], node);
+}
+
+static void release_node(timer_wheel_ptr wheel, timer_node_t *node) {
+    node->callback = NULL;
+    node->context = NULL;
+    node->generation++;
+    wheel->free_nodes[wheel->free_count++] = (uint32_t)(node - wheel->nodes);
+    wheel->pending_count--;
+}
+
+// Re-hash every timer of a higher-level slot now that it is within reach
+static void cascade(timer_wheel_ptr wheel, int level, size_t slot) {
+    timer_node_t pending;
+    list_take(&wheel->slots[level][slot], &pending);
+
+    while (pending.next != &pending) {
+        timer_node_t *node = pending.next;
+        list_unlink(node);
+        insert_node(wheel, node);
+    }
+}
+
+bool timer_wheel_init(timer_wheel_ptr wheel, size_t capacity, timestamp_ms_t current_time) {
+    memset(wheel, 0, sizeof(*wheel));
+
+    if (capacity == 0 || capacity > HANDLE_INDEX_MASK) {
+        return false;
+    }
+
+    wheel->nodes = calloc(capacity, sizeof(timer_node_t));
+    wheel->free_nodes = malloc(capacity * sizeof(uint32_t));
+    if (!wheel->nodes || !wheel->free_nodes) {
+        timer_wheel_destroy(wheel);
+        return false;
+    }
+
+    wheel->capacity = capacity;
+    timer_wheel_clear(wheel, current_time);
+    return true;
+}
+
+timer_handle_t timer_wheel_schedule(timer_wheel_ptr wheel, timestamp_ms_t deadline, timer_callback_t callback,
+                                    void *context) {
+    if (!wheel || !callback || wheel->free_count == 0) {
+        return TIMER_HANDLE_INVALID;
+    }
+
+    uint32_t index = wheel->free_nodes[--wheel->free_count];
+    timer_node_t *node = &wheel->nodes[index];
+    node->callback = callback;
+    node->context = context;
+
+    // Round up so a timer never fires before its deadline
+    node->expires_tick = time_to_tick(deadline + TIMER_WHEEL_RESOLUTION_MS - 1);
+    if (node->expires_tick <= wheel->current_tick) {
+        node->expires_tick = wheel->current_tick + 1; // Overdue timers fire on the next tick
+    }
+
+    wheel->pending_count++;
+    insert_node(wheel, node);
+
+    return ((timer_handle_t)node->generation << HANDLE_INDEX_BITS) | (index + 1);
+}
+
+bool timer_wheel_cancel(timer_wheel_ptr wheel, timer_handle_t handle) {
+    if (!wheel || handle == TIMER_HANDLE_INVALID) {
+        return false;
+    }
+
+    uint32_t index = (handle & HANDLE_INDEX_MASK) - 1;
+    if (index >= wheel->capacity) {
+        return false;
+    }
+
+    timer_node_t *node = &wheel->nodes[index];
+    if (!node->callback || node->generation != (uint16_t)(handle >> HANDLE_INDEX_BITS)) {
+        return false; // Already fired or cancelled
+    }
+
+    list_unlink(node);
+    release_node(wheel, node);
+    return true;
+}
+
+void timer_wheel_advance(timer_wheel_ptr wheel, timestamp_ms_t current_time) {
+    if (!wheel || !wheel->nodes) {
+        return;
+    }
+
+    uint64_t target_tick = time_to_tick(current_time);
+
+    while (wheel->current_tick < target_tick) {
+        if (wheel->pending_count == 0) {
+            wheel->current_tick = target_tick; // Nothing can fire; jump straight there
+            break;
+        }
+
+        wheel->current_tick++;
+
+        // Cascade higher levels whenever the level below wraps around
+        size_t slot = (size_t)(wheel->current_tick & SLOT_MASK);
+        for (int level = 1; slot == 0 && level < TIMER_WHEEL_LEVELS; level++) {
+            slot = (size_t)((wheel->current_tick >> (TIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK);
+            cascade(wheel, level, slot);
+        }
+
+        // Fire everything due in this level-0 slot
+        timer_node_t due;
+        list_take(&wheel->slots[0][wheel->current_tick & SLOT_MASK], &due);
+
+        while (due.next != &due) {
+            timer_node_t *node = due.next;
+            list_unlink(node);
+
+            if (node->expires_tick > wheel->current_tick) {
+                insert_node(wheel, node); // Parked far-future timer, not due yet
+                continue;
+            }
+
+            // Free the node before the call so the callback can reschedule
+            timer_callback_t callback = node->callback;
+            void *context = node->context;
+            release_node(wheel, node);
+            callback(wheel, context, current_time);
+        }
+    }
+}
+
+void timer_wheel_clear(timer_wheel_ptr wheel, timestamp_ms_t current_time) {
+    if (!wheel) {
+        return;
+    }
+
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        for (size_t slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            list_init(&wheel->slots[level][slot]);
+        }
+    }
+
+    // Rebuild the free stack so the lowest nodes are handed out first
+    wheel->free_count = 0;
+    for (size_t i = wheel->capacity; i > 0; i--) {
+        timer_node_t *node = &wheel->nodes[i - 1];
+        if (node->callback) {
+            node->callback = NULL;
+            node->context = NULL;
+            node->generation++;
+        }
+        list_init(node);
+        wheel->free_nodes[wheel->free_count++] = (uint32_t)(i - 1);
+    }
+
+    wheel->pending_count = 0;
+    wheel->current_tick = time_to_tick(current_time);
+}
+
+void timer_wheel_destroy(timer_wheel_ptr wheel) {
+    if (!wheel) {
+        return;
+    }
+
+    free(wheel->nodes);
+    free(wheel->free_nodes);
+    wheel->nodes = NULL;
+    wheel->free_nodes = NULL;
+    wheel->capacity = 0;
+    wheel->free_count = 0;
+    wheel->pending_count = 0;
+}
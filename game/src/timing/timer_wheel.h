@@ -0,0 +1,124 @@
+/**
+ * @file timer_wheel.h
+ * @brief Hierarchical timer wheel for time-triggered game logic
+ *
+ * Entities register a deadline and a callback instead of comparing
+ * timestamps every tick. Timers are hashed into three levels of 64 slots
+ * (4 ms, 256 ms and 16 s per slot) and cascade down as their deadline
+ * approaches, so advancing the wheel only visits slots whose time has come.
+ * Idle timers cost nothing per frame regardless of how many are pending.
+ */
+
+#ifndef GAME_SRC_TIMING_TIMER_WHEEL_H_
+#define GAME_SRC_TIMING_TIMER_WHEEL_H_
+
+#include "types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Wheel geometry
+#define TIMER_WHEEL_RESOLUTION_MS 4 // Duration of one level-0 slot
+#define TIMER_WHEEL_SLOT_BITS 6     // 64 slots per level
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_LEVELS 3
+
+// Handle value that never refers to a scheduled timer
+#define TIMER_HANDLE_INVALID 0
+
+struct timer_wheel_t;
+
+/**
+ * Timer callback, invoked once when the deadline passes
+ *
+ * @param wheel Wheel the timer fired from (callbacks may reschedule on it)
+ * @param context User pointer given when the timer was scheduled
+ * @param current_time Time the wheel was advanced to
+ */
+typedef void (*timer_callback_t)(struct timer_wheel_t *wheel, void *context, timestamp_ms_t current_time);
+
+/**
+ * Handle identifying a scheduled timer (stale handles are detected)
+ */
+typedef uint32_t timer_handle_t;
+
+/**
+ * Timer node (intrusive list entry, also used as slot sentinel)
+ */
+typedef struct timer_node_t {
+    struct timer_node_t *prev;
+    struct timer_node_t *next;
+    uint64_t expires_tick;     // Tick at which the timer fires
+    timer_callback_t callback; // NULL while the node is free
+    void *context;
+    uint16_t generation; // Bumped on every reuse so stale handles miss
+} timer_node_t;
+
+/**
+ * Timer wheel structure
+ */
+typedef struct timer_wheel_t {
+    timer_node_t slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS]; // Slot list sentinels
+    timer_node_t *nodes;                                        // Timer storage
+    uint32_t *free_nodes;                                       // Stack of free node indices
+    size_t free_count;
+    size_t capacity;
+    size_t pending_count; // Timers scheduled and not yet fired or cancelled
+    uint64_t current_tick;
+} timer_wheel_t;
+
+// Pointer typedef for timer wheel
+typedef timer_wheel_t *timer_wheel_ptr;
+
+/**
+ * @brief Initialize a timer wheel
+ * @param wheel Timer wheel to initialize
+ * @param capacity Maximum number of pending timers (at most 65535)
+ * @param current_time Time the wheel starts at
+ * @return true if successful
+ */
+bool timer_wheel_init(timer_wheel_ptr wheel, size_t capacity, timestamp_ms_t current_time);
+
+/**
+ * @brief Schedule a one-shot timer
+ * @param wheel Timer wheel
+ * @param deadline Time at which the callback should run (past deadlines fire on the next advance)
+ * @param callback Function to call
+ * @param context User pointer passed to the callback
+ * @return Handle for cancellation, TIMER_HANDLE_INVALID if the wheel is full
+ */
+timer_handle_t timer_wheel_schedule(timer_wheel_ptr wheel, timestamp_ms_t deadline, timer_callback_t callback,
+                                    void *context);
+
+/**
+ * @brief Cancel a pending timer
+ * @param wheel Timer wheel
+ * @param handle Timer handle (invalid or already fired handles are ignored)
+ * @return true if a pending timer was cancelled
+ */
+bool timer_wheel_cancel(timer_wheel_ptr wheel, timer_handle_t handle);
+
+/**
+ * @brief Advance the wheel and run the callbacks of every expired timer
+ *
+ * Callbacks may schedule or cancel timers, including rescheduling themselves.
+ *
+ * @param wheel Timer wheel
+ * @param current_time Time to advance to
+ */
+void timer_wheel_advance(timer_wheel_ptr wheel, timestamp_ms_t current_time);
+
+/**
+ * @brief Drop every pending timer without running it
+ * @param wheel Timer wheel
+ * @param current_time Time the wheel restarts at
+ */
+void timer_wheel_clear(timer_wheel_ptr wheel, timestamp_ms_t current_time);
+
+/**
+ * @brief Free the memory owned by a timer wheel
+ * @param wheel Timer wheel
+ */
+void timer_wheel_destroy(timer_wheel_ptr wheel);
+
+#endif // GAME_SRC_TIMING_TIMER_WHEEL_H_
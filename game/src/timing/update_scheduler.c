@@ -0,0 +1,86 @@
+/**
+ * @file update_scheduler.c
+ * @brief Fixed-rate update tiers implementation
+ */
+
+#include "update_scheduler.h"
+
+#include <string.h>
+
+static bool valid_divisor(uint32_t divisor) { return divisor > 0 && UPDATE_SCHEDULER_PERIOD % divisor == 0; }
+
+// Phase whose busiest tick is the least loaded (earliest phase on ties)
+static uint32_t least_loaded_phase(const update_scheduler_t *scheduler, uint32_t divisor) {
+    uint32_t best_phase = 0;
+    uint32_t best_peak = UINT32_MAX;
+
+    for (uint32_t phase = 0; phase < divisor; phase++) {
+        uint32_t peak = 0;
+        for (uint32_t t = phase; t < UPDATE_SCHEDULER_PERIOD; t += divisor) {
+            if (scheduler->load[t] > peak) {
+                peak = scheduler->load[t];
+            }
+        }
+
+        if (peak < best_peak) {
+            best_peak = peak;
+            best_phase = phase;
+        }
+    }
+
+    return best_phase;
+}
+
+static bool add_task(update_scheduler_ptr scheduler, const char *name, uint32_t divisor, uint32_t cost,
+                     update_task_fn_t run, void *context, bool sliced) {
+    if (scheduler->task_count >= UPDATE_SCHEDULER_MAX_TASKS || !valid_divisor(divisor) || !run) {
+        return false;
+    }
+
+    update_task_t *task = &scheduler->tasks[scheduler->task_count++];
+    task->name = name;
+    task->run = run;
+    task->context = context;
+    task->divisor = divisor;
+    task->sliced = sliced;
+
+    if (sliced) {
+        // A slice of the full pass lands on every tick
+        task->phase = 0;
+        uint32_t slice_cost = (cost + divisor - 1) / divisor;
+        for (uint32_t t = 0; t < UPDATE_SCHEDULER_PERIOD; t++) {
+            scheduler->load[t] += slice_cost;
+        }
+    } else {
+        task->phase = least_loaded_phase(scheduler, divisor);
+        for (uint32_t t = task->phase; t < UPDATE_SCHEDULER_PERIOD; t += divisor) {
+            scheduler->load[t] += cost;
+        }
+    }
+
+    return true;
+}
+
+void update_scheduler_init(update_scheduler_ptr scheduler) { memset(scheduler, 0, sizeof(*scheduler)); }
+
+bool update_scheduler_add(update_scheduler_ptr scheduler, const char *name, uint32_t divisor, uint32_t cost,
+                          update_task_fn_t run, void *context) {
+    return add_task(scheduler, name, divisor, cost, run, context, false);
+}
+
+bool update_scheduler_add_sliced(update_scheduler_ptr scheduler, const char *name, uint32_t divisor, uint32_t cost,
+                                 update_task_fn_t run, void *context) {
+    return add_task(scheduler, name, divisor, cost, run, context, true);
+}
+
+void update_scheduler_run(const update_scheduler_t *scheduler, sim_tick_t tick, timestamp_ms_t current_time) {
+    // The period is a multiple of every divisor, so reducing the tick first keeps phases stable across wraps
+    uint32_t period_tick = tick % UPDATE_SCHEDULER_PERIOD;
+
+    for (int i = 0; i < scheduler->task_count; i++) {
+        const update_task_t *task = &scheduler->tasks[i];
+        if (task->sliced || period_tick % task->divisor == task->phase) {
+            task->run(task->context, tick, current_time, task->divisor);
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/**
+ * @file update_scheduler.h
+ * @brief Fixed-rate update tiers for gameplay systems
+ *
+ * Each system registers once with a tick divisor (every tick, every 4th
+ * tick, 10 Hz, ...) and a rough cost. Systems that run less often than
+ * every tick are given a phase inside their period when they register,
+ * picking the phase whose busiest tick carries the least cost so far, so
+ * two 10 Hz systems never land on the same tick while other ticks idle.
+ *
+ * Sliced systems run every tick but are told their divisor, and do that
+ * fraction of their work each time (a quarter of the crabs per tick rather
+ * than all of them every 4th tick), so large populations add a constant
+ * cost per tick instead of a periodic spike.
+ *
+ * Systems run in registration order on the ticks they are due.
+ */
+
+#ifndef GAME_SRC_TIMING_UPDATE_SCHEDULER_H_
+#define GAME_SRC_TIMING_UPDATE_SCHEDULER_H_
+
+#include "kinematics.h"
+#include "types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Every divisor must divide the period (one second at 60 ticks per second)
+#define UPDATE_SCHEDULER_PERIOD 60
+#define UPDATE_SCHEDULER_MAX_TASKS 16
+
+// Common tick divisors
+#define UPDATE_EVERY_TICK 1
+#define UPDATE_EVERY_2ND_TICK 2
+#define UPDATE_EVERY_4TH_TICK 4
+#define UPDATE_10_HZ 6 // At 60 ticks per second
+
+/**
+ * System update callback
+ *
+ * @param context User pointer given at registration
+ * @param tick Current simulation tick
+ * @param current_time Current game time
+ * @param divisor Registered divisor (sliced systems do 1/divisor of their work)
+ */
+typedef void (*update_task_fn_t)(void *context, sim_tick_t tick, timestamp_ms_t current_time, uint32_t divisor);
+
+/**
+ * Registered system
+ */
+typedef struct {
+    const char *name;     // Shown in diagnostics
+    update_task_fn_t run; // Update callback
+    void *context;        // Passed to run
+    uint32_t divisor;     // Runs once every divisor ticks (or every tick when sliced)
+    uint32_t phase;       // Tick within the period the system runs on (tick % divisor)
+    bool sliced;          // Runs every tick doing 1/divisor of its work
+} update_task_t;
+
+/**
+ * Update scheduler
+ */
+typedef struct {
+    update_task_t tasks[UPDATE_SCHEDULER_MAX_TASKS];
+    int task_count;
+    uint32_t load[UPDATE_SCHEDULER_PERIOD]; // Registered cost landing on each tick of the period
+} update_scheduler_t;
+
+// Pointer typedef for update scheduler
+typedef update_scheduler_t *update_scheduler_ptr;
+
+/**
+ * @brief Start with no systems registered
+ * @param scheduler Scheduler to initialize
+ */
+void update_scheduler_init(update_scheduler_ptr scheduler);
+
+/**
+ * @brief Register a system at a fixed update rate
+ * @param scheduler Scheduler
+ * @param name System name
+ * @param divisor Tick divisor (must divide UPDATE_SCHEDULER_PERIOD)
+ * @param cost Relative cost of one full run, used to stagger phases
+ * @param run Update callback
+ * @param context User pointer passed to the callback
+ * @return true if registered, false if the table is full or the divisor is invalid
+ */
+bool update_scheduler_add(update_scheduler_ptr scheduler, const char *name, uint32_t divisor, uint32_t cost,
+                          update_task_fn_t run, void *context);
+
+/**
+ * @brief Register a system that spreads its work over every tick
+ * @param scheduler Scheduler
+ * @param name System name
+ * @param divisor Number of ticks one full pass is spread over (must divide UPDATE_SCHEDULER_PERIOD)
+ * @param cost Relative cost of one full pass
+ * @param run Update callback (told the divisor so it can do that fraction of its work)
+ * @param context User pointer passed to the callback
+ * @return true if registered, false if the table is full or the divisor is invalid
+ */
+bool update_scheduler_add_sliced(update_scheduler_ptr scheduler, const char *name, uint32_t divisor, uint32_t cost,
+                                 update_task_fn_t run, void *context);
+
+/**
+ * @brief Run every system due on a tick
+ * @param scheduler Scheduler
+ * @param tick Current simulation tick
+ * @param current_time Current game time
+ */
+void update_scheduler_run(const update_scheduler_t *scheduler, sim_tick_t tick, timestamp_ms_t current_time);
+
+#endif // GAME_SRC_TIMING_UPDATE_SCHEDULER_H_
@@ -0,0 +1,487 @@
+/**
+ * @file atlas_packer.c
+ * @brief Build-time sprite atlas packer
+ *
+ * Reads the sprite manifest, cuts every sprite out of its source sheet,
+ * turns the sheet's color key into real alpha and trims each sprite to its
+ * opaque pixels. The trimmed sprites are shelf-packed into the smallest
+ * power-of-two atlas that holds them, which is written as a PNG together
+ * with the C table of sprite rectangles the game is built with. The game
+ * then draws a whole playing frame from one texture and loads it without
+ * a color-key pass. The outputs are checked in; run `make atlas` after
+ * changing the manifest or a sheet.
+ *
+ * Usage: atlas_packer <manifest> <atlas.png> <rects.c>
+ */
+
+#include "SDL.h"
+#include "SDL_image.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ATLAS_MAX_SHEETS 8      // Source sheets per manifest
+#define ATLAS_MAX_SPRITES 256   // Sprites per manifest
+#define ATLAS_MAX_LINES 512     // Manifest lines that produce output (sprites, comments and blank lines)
+#define ATLAS_MIN_SIZE 8        // Smallest atlas side tried
+#define ATLAS_MAX_SIZE 4096     // Largest atlas side tried (a texture size every GPU supports)
+#define ATLAS_PADDING 1         // Transparent pixels between packed sprites, so filtering never picks up a neighbor
+#define ATLAS_TEXT_LENGTH 128   // Sprite names and comments
+#define ATLAS_LINE_LENGTH 512   // Manifest line
+
+/**
+ * One sprite from the manifest
+ */
+typedef struct {
+    char name[ATLAS_TEXT_LENGTH];    // Name without the SPRITE_ prefix, with [i] for array elements
+    char comment[ATLAS_TEXT_LENGTH]; // Trailing comment in the generated table (may be empty)
+    SDL_Surface *sheet;              // Source sheet
+    int x, y, w, h;                  // Rectangle in the source sheet
+    int trim_x, trim_y;              // Transparent columns left of and rows above the opaque pixels
+    int trim_w, trim_h;              // Size of the opaque pixels
+    int atlas_x, atlas_y;            // Packed position of the opaque pixels
+} atlas_sprite_t;
+
+/**
+ * Kinds of manifest line that appear in the generated table
+ */
+typedef enum { ATLAS_LINE_SPRITE, ATLAS_LINE_COMMENT, ATLAS_LINE_BLANK } atlas_line_kind_t;
+
+/**
+ * Manifest line that appears in the generated table
+ */
+typedef struct {
+    atlas_line_kind_t kind;       // What the line holds
+    int sprite;                   // Index into sprites (ATLAS_LINE_SPRITE)
+    char text[ATLAS_TEXT_LENGTH]; // Comment text (ATLAS_LINE_COMMENT)
+} atlas_line_t;
+
+/**
+ * Parsed manifest
+ */
+typedef struct {
+    SDL_Surface *sheets[ATLAS_MAX_SHEETS];
+    int sheet_count;
+    atlas_sprite_t sprites[ATLAS_MAX_SPRITES];
+    int sprite_count;
+    atlas_line_t lines[ATLAS_MAX_LINES];
+    int line_count;
+} atlas_manifest_t;
+
+static uint8_t *pixel_at(SDL_Surface *surface, int x, int y) {
+    return (uint8_t *)surface->pixels + (size_t)y * surface->pitch + (size_t)x * 4;
+}
+
+// Sheets are held as RGBA32 (R, G, B, A bytes in memory) with the color key cleared to transparent
+static SDL_Surface *load_sheet(const char *path, int key_r, int key_g, int key_b) {
+    SDL_Surface *loaded = IMG_Load(path);
+    if (!loaded) {
+        printf("Failed to load %s: %s\n", path, SDL_GetError());
+        return NULL;
+    }
+
+    SDL_Surface *sheet = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!sheet) {
+        printf("Failed to convert %s: %s\n", path, SDL_GetError());
+        return NULL;
+    }
+
+    for (int y = 0; y < sheet->h; y++) {
+        for (int x = 0; x < sheet->w; x++) {
+            uint8_t *pixel = pixel_at(sheet, x, y);
+            if ((pixel[0] == key_r && pixel[1] == key_g && pixel[2] == key_b) || pixel[3] < 128) {
+                memset(pixel, 0, 4);
+            } else {
+                pixel[3] = 255;
+            }
+        }
+    }
+
+    return sheet;
+}
+
+static bool add_line(atlas_manifest_t *manifest, atlas_line_kind_t kind, int sprite, const char *text) {
+    // Runs of blank lines, and blank lines before the first entry, collapse
+    if (kind == ATLAS_LINE_BLANK &&
+        (manifest->line_count == 0 || manifest->lines[manifest->line_count - 1].kind == ATLAS_LINE_BLANK)) {
+        return true;
+    }
+    if (manifest->line_count == ATLAS_MAX_LINES) {
+        printf("Manifest has more than %d lines\n", ATLAS_MAX_LINES);
+        return false;
+    }
+
+    atlas_line_t *line = &manifest->lines[manifest->line_count++];
+    line->kind = kind;
+    line->sprite = sprite;
+    snprintf(line->text, sizeof(line->text), "%s", text);
+    return true;
+}
+
+static bool parse_sprite(atlas_manifest_t *manifest, const char *line, SDL_Surface *sheet, int line_number) {
+    if (!sheet) {
+        printf("Line %d: sprite before any sheet\n", line_number);
+        return false;
+    }
+    if (manifest->sprite_count == ATLAS_MAX_SPRITES) {
+        printf("Line %d: more than %d sprites\n", line_number, ATLAS_MAX_SPRITES);
+        return false;
+    }
+
+    atlas_sprite_t *sprite = &manifest->sprites[manifest->sprite_count];
+    memset(sprite, 0, sizeof(*sprite));
+    int consumed = 0;
+    if (sscanf(line, "%127s %d %d %d %d %n", sprite->name, &sprite->x, &sprite->y, &sprite->w, &sprite->h,
+               &consumed) != 5) {
+        printf("Line %d: expected <NAME> <x> <y> <w> <h>\n", line_number);
+        return false;
+    }
+    snprintf(sprite->comment, sizeof(sprite->comment), "%s", line + consumed);
+
+    if (sprite->w <= 0 || sprite->h <= 0 || sprite->x < 0 || sprite->y < 0 || sprite->x + sprite->w > sheet->w ||
+        sprite->y + sprite->h > sheet->h) {
+        printf("Line %d: %s lies outside its %dx%d sheet\n", line_number, sprite->name, sheet->w, sheet->h);
+        return false;
+    }
+
+    sprite->sheet = sheet;
+    return add_line(manifest, ATLAS_LINE_SPRITE, manifest->sprite_count++, "");
+}
+
+static bool parse_manifest(atlas_manifest_t *manifest, const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        printf("Failed to open manifest %s\n", path);
+        return false;
+    }
+
+    char line[ATLAS_LINE_LENGTH];
+    SDL_Surface *sheet = NULL;
+    int line_number = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), file)) {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        const char *start = line + strspn(line, " \t");
+        if (start[0] == '#') {
+            continue;
+        }
+
+        if (start[0] == '\0') {
+            ok = add_line(manifest, ATLAS_LINE_BLANK, -1, "");
+        } else if (strncmp(start, "//", 2) == 0) {
+            ok = add_line(manifest, ATLAS_LINE_COMMENT, -1, start);
+        } else if (strncmp(start, "sheet ", 6) == 0) {
+            char sheet_path[ATLAS_LINE_LENGTH];
+            int key_r, key_g, key_b;
+            if (sscanf(start + 6, "%511s %d %d %d", sheet_path, &key_r, &key_g, &key_b) != 4) {
+                printf("Line %d: expected sheet <image> <r> <g> <b>\n", line_number);
+                ok = false;
+            } else if (manifest->sheet_count == ATLAS_MAX_SHEETS) {
+                printf("Line %d: more than %d sheets\n", line_number, ATLAS_MAX_SHEETS);
+                ok = false;
+            } else {
+                sheet = load_sheet(sheet_path, key_r, key_g, key_b);
+                manifest->sheets[manifest->sheet_count++] = sheet;
+                ok = sheet != NULL;
+            }
+        } else {
+            ok = parse_sprite(manifest, start, sheet, line_number);
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+// Bounds of the opaque pixels; a sprite with none is a mistake in the manifest
+static bool trim_sprite(atlas_sprite_t *sprite) {
+    int left = sprite->w, top = sprite->h, right = -1, bottom = -1;
+    for (int y = 0; y < sprite->h; y++) {
+        for (int x = 0; x < sprite->w; x++) {
+            if (pixel_at(sprite->sheet, sprite->x + x, sprite->y + y)[3] != 0) {
+                left = x < left ? x : left;
+                right = x > right ? x : right;
+                top = y < top ? y : top;
+                bottom = y > bottom ? y : bottom;
+            }
+        }
+    }
+
+    if (right < 0) {
+        printf("%s has no opaque pixels\n", sprite->name);
+        return false;
+    }
+
+    sprite->trim_x = left;
+    sprite->trim_y = top;
+    sprite->trim_w = right - left + 1;
+    sprite->trim_h = bottom - top + 1;
+    return true;
+}
+
+static const atlas_sprite_t *sort_sprites; // Sprites the comparator indexes (qsort has no context argument)
+
+// Tallest first, then widest, then manifest order, so the packing never depends on the qsort implementation
+static int compare_for_packing(const void *a, const void *b) {
+    const atlas_sprite_t *sprite_a = &sort_sprites[*(const int *)a];
+    const atlas_sprite_t *sprite_b = &sort_sprites[*(const int *)b];
+    if (sprite_a->trim_h != sprite_b->trim_h) {
+        return sprite_b->trim_h - sprite_a->trim_h;
+    }
+    if (sprite_a->trim_w != sprite_b->trim_w) {
+        return sprite_b->trim_w - sprite_a->trim_w;
+    }
+    return *(const int *)a - *(const int *)b;
+}
+
+// Shelf packing: left to right along a shelf as tall as its first sprite, then the next shelf below
+static bool pack_sprites(atlas_manifest_t *manifest, const int *order, int width, int height) {
+    int x = 0, y = 0, shelf_height = 0;
+    for (int i = 0; i < manifest->sprite_count; i++) {
+        atlas_sprite_t *sprite = &manifest->sprites[order[i]];
+        if (sprite->trim_w > width) {
+            return false;
+        }
+        if (x + sprite->trim_w > width) {
+            x = 0;
+            y += shelf_height + ATLAS_PADDING;
+            shelf_height = 0;
+        }
+        if (y + sprite->trim_h > height) {
+            return false;
+        }
+
+        sprite->atlas_x = x;
+        sprite->atlas_y = y;
+        x += sprite->trim_w + ATLAS_PADDING;
+        shelf_height = sprite->trim_h > shelf_height ? sprite->trim_h : shelf_height;
+    }
+    return true;
+}
+
+// Smallest power-of-two atlas that holds every sprite, preferring the squarer of two equal areas
+static bool pack_atlas(atlas_manifest_t *manifest, int *atlas_width, int *atlas_height) {
+    int order[ATLAS_MAX_SPRITES];
+    for (int i = 0; i < manifest->sprite_count; i++) {
+        order[i] = i;
+    }
+    sort_sprites = manifest->sprites;
+    qsort(order, (size_t)manifest->sprite_count, sizeof(order[0]), compare_for_packing);
+
+    long best_area = 0;
+    int best_width = 0, best_height = 0;
+    for (int height = ATLAS_MIN_SIZE; height <= ATLAS_MAX_SIZE; height *= 2) {
+        for (int width = height; width <= ATLAS_MAX_SIZE && width <= 2 * height; width *= 2) {
+            long area = (long)width * height;
+            if ((best_area == 0 || area < best_area) && pack_sprites(manifest, order, width, height)) {
+                best_area = area;
+                best_width = width;
+                best_height = height;
+            }
+        }
+    }
+
+    if (best_area == 0) {
+        printf("Sprites do not fit a %dx%d atlas\n", ATLAS_MAX_SIZE, ATLAS_MAX_SIZE);
+        return false;
+    }
+
+    pack_sprites(manifest, order, best_width, best_height);
+    *atlas_width = best_width;
+    *atlas_height = best_height;
+    return true;
+}
+
+static bool write_atlas_image(const atlas_manifest_t *manifest, const char *path, int width, int height) {
+    SDL_Surface *atlas = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!atlas) {
+        printf("Failed to create the atlas: %s\n", SDL_GetError());
+        return false;
+    }
+
+    // Everything between the sprites stays fully transparent
+    for (int y = 0; y < height; y++) {
+        memset(pixel_at(atlas, 0, y), 0, (size_t)width * 4);
+    }
+
+    for (int i = 0; i < manifest->sprite_count; i++) {
+        const atlas_sprite_t *sprite = &manifest->sprites[i];
+        for (int row = 0; row < sprite->trim_h; row++) {
+            memcpy(pixel_at(atlas, sprite->atlas_x, sprite->atlas_y + row),
+                   pixel_at(sprite->sheet, sprite->x + sprite->trim_x, sprite->y + sprite->trim_y + row),
+                   (size_t)sprite->trim_w * 4);
+        }
+    }
+
+    bool written = IMG_SavePNG(atlas, path) == 0;
+    if (!written) {
+        printf("Failed to write %s: %s\n", path, SDL_GetError());
+    }
+    SDL_FreeSurface(atlas);
+    return written;
+}
+
+// Length of the array name in NAME[i], or 0 for a plain sprite
+static size_t array_name_length(const char *name) {
+    const char *bracket = strchr(name, '[');
+    return bracket ? (size_t)(bracket - name) : 0;
+}
+
+static void format_rect(char *text, size_t size, const atlas_sprite_t *sprite) {
+    snprintf(text, size, "{%d, %d, %d, %d, %d, %d, %d, %d}", sprite->atlas_x, sprite->atlas_y, sprite->trim_w,
+             sprite->trim_h, sprite->trim_x, sprite->trim_y, sprite->w, sprite->h);
+}
+
+// Prints a run of lines with their trailing comments aligned, as clang-format lays them out
+static void write_aligned(FILE *file, char code[][2 * ATLAS_TEXT_LENGTH], char comments[][ATLAS_TEXT_LENGTH],
+                          int count) {
+    int column = 0;
+    for (int i = 0; i < count; i++) {
+        int length = (int)strlen(code[i]);
+        column = comments[i][0] != '\0' && length > column ? length : column;
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (comments[i][0] != '\0') {
+            fprintf(file, "%-*s // %s\n", column, code[i], comments[i]);
+        } else {
+            fprintf(file, "%s\n", code[i]);
+        }
+    }
+}
+
+// Sprite lines from index onward up to the next comment, blank line or array (or the next element of this array)
+static int sprite_run_length(const atlas_manifest_t *manifest, int index) {
+    const atlas_sprite_t *first = &manifest->sprites[manifest->lines[index].sprite];
+    size_t array_length = array_name_length(first->name);
+
+    int count = 0;
+    while (index + count < manifest->line_count && manifest->lines[index + count].kind == ATLAS_LINE_SPRITE) {
+        const atlas_sprite_t *sprite = &manifest->sprites[manifest->lines[index + count].sprite];
+        size_t length = array_name_length(sprite->name);
+        if (length != array_length || (array_length > 0 && strncmp(sprite->name, first->name, array_length) != 0)) {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+static bool write_sprite_run(FILE *file, const atlas_manifest_t *manifest, int index, int count) {
+    static char code[ATLAS_MAX_SPRITES][2 * ATLAS_TEXT_LENGTH];
+    static char comments[ATLAS_MAX_SPRITES][ATLAS_TEXT_LENGTH];
+
+    const atlas_sprite_t *first = &manifest->sprites[manifest->lines[index].sprite];
+    size_t array_length = array_name_length(first->name);
+
+    for (int i = 0; i < count; i++) {
+        const atlas_sprite_t *sprite = &manifest->sprites[manifest->lines[index + i].sprite];
+        char rect[ATLAS_TEXT_LENGTH];
+        format_rect(rect, sizeof(rect), sprite);
+        snprintf(comments[i], sizeof(comments[i]), "%s", sprite->comment);
+
+        if (array_length == 0) {
+            snprintf(code[i], sizeof(code[i]), "const sprite_rect_t SPRITE_%s = %s;", sprite->name, rect);
+            continue;
+        }
+
+        int element = -1;
+        if (sscanf(sprite->name + array_length, "[%d]", &element) != 1 || element != i) {
+            printf("%s: array elements must be listed in order from [0]\n", sprite->name);
+            return false;
+        }
+        snprintf(code[i], sizeof(code[i]), "    %s%s", rect, i + 1 < count ? "," : "");
+    }
+
+    if (array_length > 0) {
+        fprintf(file, "const sprite_rect_t SPRITE_%.*s[%d] = {\n", (int)array_length, first->name, count);
+    }
+    write_aligned(file, code, comments, count);
+    if (array_length > 0) {
+        fprintf(file, "};\n");
+    }
+    return true;
+}
+
+static bool write_rects_source(const atlas_manifest_t *manifest, const char *path, const char *manifest_path,
+                               int width, int height) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        printf("Failed to create %s\n", path);
+        return false;
+    }
+
+    const char *file_name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    fprintf(file,
+            "/**\n"
+            " * @file %s\n"
+            " * @brief Sprite rectangles in the packed %dx%d sprite atlas\n"
+            " *\n"
+            " * Generated by atlas_packer from %s\n"
+            " * (`make atlas`); edit the manifest, not this file.\n"
+            " */\n"
+            "\n"
+            "#include \"sprite_atlas.h\"\n"
+            "\n",
+            file_name, width, height, manifest_path);
+
+    bool ok = true;
+    int index = 0;
+    while (ok && index < manifest->line_count) {
+        const atlas_line_t *line = &manifest->lines[index];
+        if (line->kind == ATLAS_LINE_SPRITE) {
+            int count = sprite_run_length(manifest, index);
+            ok = write_sprite_run(file, manifest, index, count);
+            index += count;
+            continue;
+        }
+
+        // The manifest's own spacing, without a trailing blank line
+        if (line->kind == ATLAS_LINE_COMMENT) {
+            fprintf(file, "%s\n", line->text);
+        } else if (index + 1 < manifest->line_count) {
+            fprintf(file, "\n");
+        }
+        index++;
+    }
+
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 4) {
+        printf("Usage: %s <manifest> <atlas.png> <rects.c>\n", argv[0]);
+        return 1;
+    }
+
+    static atlas_manifest_t manifest;
+    bool ok = parse_manifest(&manifest, argv[1]);
+    if (ok && manifest.sprite_count == 0) {
+        printf("%s lists no sprites\n", argv[1]);
+        ok = false;
+    }
+    for (int i = 0; ok && i < manifest.sprite_count; i++) {
+        ok = trim_sprite(&manifest.sprites[i]);
+    }
+
+    int width = 0, height = 0;
+    ok = ok && pack_atlas(&manifest, &width, &height) && write_atlas_image(&manifest, argv[2], width, height) &&
+         write_rects_source(&manifest, argv[3], argv[1], width, height);
+
+    if (ok) {
+        printf("Packed %d sprites into a %dx%d atlas\n", manifest.sprite_count, width, height);
+    }
+
+    for (int i = 0; i < manifest.sheet_count; i++) {
+        SDL_FreeSurface(manifest.sheets[i]);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file entity_pool_bench.c
+ * @brief Benchmark of the aligned entity pool against the engine object pool
+ *
+ * Times the three things the game does with its pools, on crab-sized
+ * elements at a stress-test population: acquiring a full pool, releasing
+ * it, acquiring again into a half-used pool (every other slot released,
+ * as after a wave of collisions), and iterating the survivors the way the
+ * update loops do. The engine's object_pool_t is walked with
+ * pool_is_active + pool_get_at, as the game did before entity_pool_t.
+ * `make bench-pool` builds and runs it.
+ */
+
+#include "crab.h"
+#include "entity_pool.h"
+#include "object_pool.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_ELEMENTS 16384 // Pool capacity and population
+#define BENCH_ROUNDS 50      // Timed rounds per operation
+#define BENCH_ITERATIONS 500 // Timed walks over the half-used pool
+
+/**
+ * Nanoseconds per element for each operation
+ */
+typedef struct {
+    double acquire;   // Acquire into an empty pool
+    double release;   // Release every element
+    double reacquire; // Acquire into the slots of a half-used pool
+    double iterate;   // Visit one active element
+} bench_result_t;
+
+static volatile float bench_sink; // Keeps the iteration work from being optimized away
+
+static double elapsed_ns(clock_t start, double operations) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / operations;
+}
+
+static bench_result_t bench_object_pool(void) {
+    static size_t indices[BENCH_ELEMENTS];
+    object_pool_t pool = create_object_pool(sizeof(crab_t), BENCH_ELEMENTS);
+    bench_result_t result = {0};
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        clock_t start = clock();
+        for (size_t i = 0; i < BENCH_ELEMENTS; i++) {
+            crab_ptr crab = (crab_ptr)pool_acquire(&pool, &indices[i]);
+            crab->y = (float)i;
+        }
+        result.acquire += elapsed_ns(start, (double)BENCH_ELEMENTS * BENCH_ROUNDS);
+
+        start = clock();
+        for (size_t i = 0; i < BENCH_ELEMENTS; i++) {
+            pool_release(&pool, indices[i]);
+        }
+        result.release += elapsed_ns(start, (double)BENCH_ELEMENTS * BENCH_ROUNDS);
+    }
+
+    // Half-used pool: everything acquired, then every other element released
+    for (size_t i = 0; i < BENCH_ELEMENTS; i++) {
+        crab_ptr crab = (crab_ptr)pool_acquire(&pool, &indices[i]);
+        crab->y = (float)i;
+    }
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (size_t i = 0; i < BENCH_ELEMENTS; i += 2) {
+            pool_release(&pool, indices[i]);
+        }
+        clock_t start = clock();
+        for (size_t i = 0; i < BENCH_ELEMENTS; i += 2) {
+            pool_acquire(&pool, &indices[i]);
+        }
+        result.reacquire += elapsed_ns(start, (double)BENCH_ELEMENTS / 2 * BENCH_ROUNDS);
+    }
+    for (size_t i = 0; i < BENCH_ELEMENTS; i += 2) {
+        pool_release(&pool, indices[i]);
+    }
+
+    clock_t start = clock();
+    for (int walk = 0; walk < BENCH_ITERATIONS; walk++) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < pool.capacity; i++) {
+            if (!pool_is_active(&pool, i))
+                continue;
+            sum += ((crab_ptr)pool_get_at(&pool, i))->y;
+        }
+        bench_sink = sum;
+    }
+    result.iterate = elapsed_ns(start, (double)BENCH_ELEMENTS / 2 * BENCH_ITERATIONS);
+
+    pool_destroy(&pool);
+    return result;
+}
+
+static bench_result_t bench_entity_pool(void) {
+    static size_t indices[BENCH_ELEMENTS];
+    entity_pool_t pool = create_entity_pool(sizeof(crab_t), BENCH_ELEMENTS);
+    bench_result_t result = {0};
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        clock_t start = clock();
+        for (size_t i = 0; i < BENCH_ELEMENTS; i++) {
+            crab_ptr crab = (crab_ptr)entity_pool_acquire(&pool, &indices[i]);
+            crab->y = (float)i;
+        }
+        result.acquire += elapsed_ns(start, (double)BENCH_ELEMENTS * BENCH_ROUNDS);
+
+        start = clock();
+        for (size_t i = 0; i < BENCH_ELEMENTS; i++) {
+            entity_pool_release(&pool, indices[i]);
+        }
+        result.release += elapsed_ns(start, (double)BENCH_ELEMENTS * BENCH_ROUNDS);
+    }
+
+    // Half-used pool: everything acquired, then every other element released
+    for (size_t i = 0; i < BENCH_ELEMENTS; i++) {
+        crab_ptr crab = (crab_ptr)entity_pool_acquire(&pool, &indices[i]);
+        crab->y = (float)i;
+    }
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (size_t i = 0; i < BENCH_ELEMENTS; i += 2) {
+            entity_pool_release(&pool, indices[i]);
+        }
+        clock_t start = clock();
+        for (size_t i = 0; i < BENCH_ELEMENTS; i += 2) {
+            entity_pool_acquire(&pool, &indices[i]);
+        }
+        result.reacquire += elapsed_ns(start, (double)BENCH_ELEMENTS / 2 * BENCH_ROUNDS);
+    }
+    for (size_t i = 0; i < BENCH_ELEMENTS; i += 2) {
+        entity_pool_release(&pool, indices[i]);
+    }
+
+    clock_t start = clock();
+    for (int walk = 0; walk < BENCH_ITERATIONS; walk++) {
+        float sum = 0.0f;
+        entity_pool_iter_t iter = entity_pool_iter(&pool);
+        while (entity_pool_iter_next(&iter)) {
+            sum += ((crab_ptr)iter.element)->y;
+        }
+        bench_sink = sum;
+    }
+    result.iterate = elapsed_ns(start, (double)BENCH_ELEMENTS / 2 * BENCH_ITERATIONS);
+
+    entity_pool_destroy(&pool);
+    return result;
+}
+
+static void print_row(const char *operation, double object_ns, double entity_ns) {
+    printf("%-10s %10.2f %10.2f %8.2fx\n", operation, object_ns, entity_ns,
+           entity_ns > 0.0 ? object_ns / entity_ns : 0.0);
+}
+
+int main(void) {
+    printf("%d crab-sized elements (%zu bytes), ns per element\n", BENCH_ELEMENTS, sizeof(crab_t));
+    printf("%-10s %10s %10s %9s\n", "", "object", "entity", "speedup");
+
+    bench_result_t object = bench_object_pool();
+    bench_result_t entity = bench_entity_pool();
+
+    print_row("acquire", object.acquire, entity.acquire);
+    print_row("release", object.release, entity.release);
+    print_row("reacquire", object.reacquire, entity.reacquire);
+    print_row("iterate", object.iterate, entity.iterate);
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file popcorn_pass_bench.c
+ * @brief Benchmark of the fused popcorn pass against separate passes
+ *
+ * Builds a frozen stress scene (a full popcorn ring and a thousand crabs,
+ * with nothing moving and nothing colliding, so every frame does the same
+ * work) and times the per-frame popcorn work both ways: the separate
+ * release sweep, collision pass and render walk, and the single fused pass
+ * that does all three per popcorn. `make bench-popcorn` builds and runs it.
+ */
+
+#include "collision_system.h"
+#include "constants.h"
+#include "entity_factory.h"
+#include "game.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_SEED 1983       // srand() seed for the crab layout
+#define BENCH_CRABS 1000      // Crab population of the stress mode
+#define BENCH_FRAMES 20000    // Timed frames per variant
+#define BENCH_WARMUP 200      // Untimed frames before each variant
+#define BENCH_CRAB_BAND 100   // Crabs are parked above this line
+#define BENCH_POPCORN_TOP 120 // Popcorn is parked below this line (part of it inside the crab zone)
+
+static void run_separate_passes(game_ptr game) {
+    game->fused_popcorn_pass = false;
+    popcorn_update_all(&game->popcorn_pool);
+    collision_system_update(game);
+    popcorn_draw_list_build(&game->popcorn_draws, &game->popcorn_pool, game->sim_tick);
+}
+
+static void run_fused_pass(game_ptr game) {
+    game->fused_popcorn_pass = true;
+    collision_system_update(game);
+}
+
+static double time_frames(game_ptr game, void (*frame)(game_ptr)) {
+    for (int i = 0; i < BENCH_WARMUP; i++) {
+        frame(game);
+    }
+
+    clock_t start = clock();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        frame(game);
+    }
+    clock_t elapsed = clock() - start;
+
+    return (double)elapsed / CLOCKS_PER_SEC * 1e9 / BENCH_FRAMES;
+}
+
+static void build_scene(game_ptr game) {
+    timestamp_ms_t current_time = 0;
+    srand(BENCH_SEED);
+
+    create_entity_pools(game);
+    popcorn_draw_list_init(&game->popcorn_draws, game->popcorn_pool.max_capacity);
+    timer_wheel_init(&game->timers, game->crab_pool.max_capacity + game->brick_pool.max_capacity + GAME_TIMER_SLACK,
+                     current_time);
+    motion_event_queue_init(&game->motion_events, GAME_MOTION_EVENT_CAPACITY);
+    sprite_animation_system_init(&game->animations, game->crab_pool.max_capacity + NUM_JELLYFISH + 1);
+    collision_system_init(game);
+
+    // The duck only matters for reflected popcorn, and none is reflected
+    create_duck(&game->duck, SIM_FROM_INT(LOGICAL_WIDTH) / 2, SIM_FROM_INT(LAKE_START_Y - DUCK_HEIGHT));
+
+    // Park the crabs in a band at the top of the crab zone
+    crab_t prototype = make_crab_prototype();
+    spawn_crabs_from_prototype(&game->crab_pool, &game->timers, &game->animations, &game->motion_events, &prototype,
+                               BENCH_CRABS, game->sim_tick, current_time, false);
+    entity_pool_iter_t crab_iter = entity_pool_iter(&game->crab_pool);
+    while (entity_pool_iter_next(&crab_iter)) {
+        crab_ptr crab = (crab_ptr)crab_iter.element;
+        crab->motion = linear_motion(crab_x(crab, game->sim_tick), 0, game->sim_tick);
+        crab->y = SIM_FROM_INT(rand() % (BENCH_CRAB_BAND - CRAB_HEIGHT));
+    }
+
+    // Formation below the screen, so popcorn only pays for its bounding box test
+    const int jellyfish_spacing = 1;
+    create_jellyfish_formation(&game->jellyfish_formation, 0, SIM_FROM_INT(LOGICAL_HEIGHT * 2), 0, true, NUM_JELLYFISH,
+                               SIM_FROM_INT(jellyfish_spacing), game->sim_tick);
+
+    // Fill the popcorn pool with shots hanging between the crabs and the lake
+    const int popcorn_span = LAKE_START_Y - BENCH_POPCORN_TOP - POPCORN_HEIGHT;
+    for (size_t i = 0; i < game->popcorn_pool.max_capacity; i++) {
+        sim_scalar_t x = SIM_FROM_INT(rand() % (LOGICAL_WIDTH - POPCORN_WIDTH));
+        sim_scalar_t y = SIM_FROM_INT(BENCH_POPCORN_TOP + rand() % popcorn_span);
+        popcorn_spawn(&game->popcorn_pool, &game->motion_events, game->sim_tick, x, y);
+    }
+
+    ring_pool_iter_t popcorn_iter = ring_pool_iter(&game->popcorn_pool);
+    while (ring_pool_iter_next(&popcorn_iter)) {
+        popcorn_ptr popcorn = (popcorn_ptr)popcorn_iter.element;
+        popcorn->motion = linear_motion(popcorn_y(popcorn, game->sim_tick), 0, game->sim_tick);
+    }
+}
+
+int main(void) {
+    static game_t game;
+    build_scene(&game);
+
+    printf("Popcorn %zu, crabs %zu, %d frames per variant\n", game.popcorn_pool.active_count,
+           game.crab_pool.active_count, BENCH_FRAMES);
+
+    double separate_ns = time_frames(&game, run_separate_passes);
+    size_t separate_draws = game.popcorn_draws.count;
+    double fused_ns = time_frames(&game, run_fused_pass);
+    size_t fused_draws = game.popcorn_draws.count;
+
+    printf("separate passes %10.0f ns/frame (%zu draws)\n", separate_ns, separate_draws);
+    printf("fused pass      %10.0f ns/frame (%zu draws), %.2fx\n", fused_ns, fused_draws,
+           fused_ns > 0.0 ? separate_ns / fused_ns : 0.0);
+
+    int status = separate_draws == fused_draws ? 0 : 1;
+    if (status != 0) {
+        printf("Draw lists differ between the two variants\n");
+    }
+
+    collision_system_cleanup();
+    popcorn_draw_list_destroy(&game.popcorn_draws);
+    destroy_entity_pools(&game);
+    timer_wheel_destroy(&game.timers);
+    motion_event_queue_destroy(&game.motion_events);
+    sprite_animation_system_destroy(&game.animations);
+    return status;
+}
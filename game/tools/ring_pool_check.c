@@ -0,0 +1,117 @@
+/**
+ * @file ring_pool_check.c
+ * @brief Check that head sweeps drain every ring segment on their own
+ *
+ * Acquisition moves to the first ring segment with room, so a segment late
+ * in the pool can hold older elements than segment 0. For each sweep the
+ * game uses to reclaim expired ring elements (popcorn_update_all, the fused
+ * popcorn collision pass and bricks_update_all), the check fills two
+ * segments, pins the head of segment 0 with a live element, expires all
+ * the rest and sweeps once. Segment 1 must come back empty and refill
+ * without chaining a third segment. `make ring-pool-check` builds and runs it.
+ */
+
+#include "collision_system.h"
+#include "constants.h"
+#include "entity_factory.h"
+#include "game.h"
+
+#include <stdio.h>
+
+typedef void (*sweep_fn_t)(game_ptr game, ring_pool_t *pool);
+typedef void (*expire_fn_t)(void *element, bool live);
+
+static void expire_popcorn(void *element, bool live) {
+    popcorn_ptr popcorn = (popcorn_ptr)element;
+    popcorn->active = live;
+    popcorn->reflected = false;
+    popcorn->exit_event = MOTION_EVENT_NONE;
+    popcorn->x = 0;
+    popcorn->motion = linear_motion(SIM_FROM_INT(LOGICAL_HEIGHT - POPCORN_HEIGHT), 0, 0); // Still, below the crabs
+}
+
+static void expire_brick(void *element, bool live) {
+    brick_ptr brick = (brick_ptr)element;
+    brick->active = live;
+    brick->landed = false;
+    brick->land_event = MOTION_EVENT_NONE;
+    brick->expire_timer = TIMER_HANDLE_INVALID;
+}
+
+static void sweep_popcorn(game_ptr game, ring_pool_t *pool) {
+    (void)game;
+    popcorn_update_all(pool);
+}
+
+static void sweep_popcorn_fused(game_ptr game, ring_pool_t *pool) {
+    (void)pool;
+    game->fused_popcorn_pass = true;
+    collision_system_update(game);
+}
+
+static void sweep_bricks(game_ptr game, ring_pool_t *pool) { bricks_update_all(pool, &game->timers); }
+
+static bool check_sweep(game_ptr game, ring_pool_t *pool, const char *name, expire_fn_t expire, sweep_fn_t sweep) {
+    size_t segment_capacity = pool->mask + 1;
+    ring_pool_reset(pool);
+
+    // Two full segments; only the oldest element of segment 0 stays live
+    for (size_t i = 0; i < 2 * segment_capacity; i++) {
+        void *element = ring_pool_acquire(pool, NULL);
+        if (!element) {
+            printf("%-14s FAILED: could not fill two segments\n", name);
+            return false;
+        }
+        expire(element, i == 0);
+    }
+
+    sweep(game, pool);
+
+    const ring_segment_t *second = &pool->segments[1];
+    if (second->head != second->tail) {
+        printf("%-14s FAILED: segment 1 still holds %zu expired slots\n", name, second->tail - second->head);
+        return false;
+    }
+
+    // The drained segment takes a full segment's worth of new elements without growing the pool
+    size_t segments = pool->segment_count;
+    for (size_t i = 0; i < segment_capacity; i++) {
+        void *element = ring_pool_acquire(pool, NULL);
+        if (!element) {
+            printf("%-14s FAILED: acquire failed after the sweep\n", name);
+            return false;
+        }
+        expire(element, true);
+    }
+    if (pool->segment_count != segments) {
+        printf("%-14s FAILED: chained a segment instead of reusing segment 1\n", name);
+        return false;
+    }
+
+    printf("%-14s ok\n", name);
+    return true;
+}
+
+int main(void) {
+    static game_t game;
+
+    create_entity_pools(&game);
+    popcorn_draw_list_init(&game.popcorn_draws, game.popcorn_pool.max_capacity);
+    timer_wheel_init(&game.timers, game.crab_pool.max_capacity + game.brick_pool.max_capacity + GAME_TIMER_SLACK, 0);
+    motion_event_queue_init(&game.motion_events, GAME_MOTION_EVENT_CAPACITY);
+    if (!collision_system_init(&game)) {
+        printf("Failed to initialize the collision system\n");
+        return 1;
+    }
+
+    bool passed = check_sweep(&game, &game.popcorn_pool, "popcorn", expire_popcorn, sweep_popcorn);
+    passed = check_sweep(&game, &game.popcorn_pool, "popcorn fused", expire_popcorn, sweep_popcorn_fused) && passed;
+    passed = check_sweep(&game, &game.brick_pool, "bricks", expire_brick, sweep_bricks) && passed;
+
+    collision_system_cleanup();
+    popcorn_draw_list_destroy(&game.popcorn_draws);
+    timer_wheel_destroy(&game.timers);
+    motion_event_queue_destroy(&game.motion_events);
+    destroy_entity_pools(&game);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file state_hash_check.c
+ * @brief Headless scripted simulation that prints state hashes
+ *
+ * Sets a game up the way game_init does, minus the window, resources and
+ * audio device, and runs the game's own gameplay simulation (the playing
+ * stage's scheduler, motion events and timers, then the collision system
+ * with its score and particle subscribers) for a fixed number of ticks.
+ * A scripted player sweeps the lake and keeps firing through the same
+ * input path as the keyboard, on a fixed clock; a lost game restarts the
+ * way the game-over screen does. A state hash is printed at regular
+ * checkpoints. `make determinism-check` builds it twice with different
+ * compiler flags in the deterministic profile and fails if the outputs
+ * differ.
+ */
+
+#include "collision_system.h"
+#include "constants.h"
+#include "entity_initializer.h"
+#include "game.h"
+#include "gameplay_simulation.h"
+#include "particle_effects.h"
+#include "player_controller.h"
+#include "score.h"
+#include "state_hash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHECK_SEED 1983           // srand() and particle seed for drop delays, waves and the jellyfish
+#define CHECK_TICKS 36000         // Ten minutes of play at 60 ticks per second
+#define CHECK_REPORT_INTERVAL 600 // Ticks between printed checkpoints
+#define CHECK_FIRE_INTERVAL 7     // Ticks between shots
+#define CHECK_SWEEP_TICKS 240     // Ticks before the player turns around even without reaching an edge
+
+static state_hash_t hash_state(game_ptr game) {
+    state_hash_t hash = state_hash_u32(STATE_HASH_SEED, game->sim_tick);
+    hash = state_hash_u32(hash, (uint32_t)game->score);
+    hash = state_hash_u32(hash, (uint32_t)game->lives);
+    hash = state_hash_u32(hash, (uint32_t)game->crabs_with_bricks);
+    hash = state_hash_duck(hash, &game->duck);
+    hash = state_hash_crabs(hash, &game->crab_pool, game->sim_tick);
+    hash = state_hash_popcorn(hash, &game->popcorn_pool, game->sim_tick);
+    hash = state_hash_bricks(hash, &game->brick_pool, game->sim_tick);
+    return state_hash_jellyfish(hash, &game->jellyfish_formation);
+}
+
+// Scripted player: sweep the lake edge to edge (turning around now and then, in case landed bricks block the way)
+// and keep firing
+static uint8_t scripted_input(game_ptr game, int tick, uint8_t *direction) {
+    if (game->duck.x <= 0) {
+        *direction = PLAYER_INPUT_RIGHT;
+    } else if (game->duck.x + SIM_FROM_INT(DUCK_WIDTH) >= SIM_FROM_INT(LOGICAL_WIDTH)) {
+        *direction = PLAYER_INPUT_LEFT;
+    } else if (tick % CHECK_SWEEP_TICKS == 0) {
+        *direction = *direction == PLAYER_INPUT_LEFT ? PLAYER_INPUT_RIGHT : PLAYER_INPUT_LEFT;
+    }
+
+    uint8_t input = *direction;
+    if (tick % CHECK_FIRE_INTERVAL == 0) {
+        input |= PLAYER_INPUT_FIRE;
+    }
+    return input;
+}
+
+int main(void) {
+    static game_t game;
+    static gameplay_simulation_t simulation;
+    srand(CHECK_SEED);
+
+    // Same state as game_init on a fixed clock; no sounds are loaded, so sound effects are silent
+    game.event_system = create_event_system();
+    game.sim_time = 0;
+    initialize_all_entities(&game);
+    game.fused_popcorn_pass = true;
+    if (!collision_system_init(&game)) {
+        printf("Failed to initialize the collision system\n");
+        return 1;
+    }
+    subscribe_score_events(&game);
+    if (!particle_system_init(&game.particles, PARTICLE_CAPACITY, PARTICLE_GRAVITY, LOGICAL_HEIGHT, PARTICLE_SIZE,
+                              CHECK_SEED)) {
+        printf("Failed to initialize the particle system\n");
+        return 1;
+    }
+    subscribe_particle_events(&game);
+    game.lives = INITIAL_LIVES;
+    game.score = 0;
+
+    gameplay_simulation_init(&simulation, &game);
+
+    uint8_t direction = PLAYER_INPUT_RIGHT;
+    for (int tick = 1; tick <= CHECK_TICKS; tick++) {
+        game.sim_time += FRAME_DELAY;
+        player_apply_input(&game, scripted_input(&game, tick, &direction));
+
+        if (!gameplay_simulation_tick(&simulation)) {
+            // Out of lives: start over as game_restart does
+            reset_all_entities(&game);
+            particle_system_clear(&game.particles);
+            game.lives = INITIAL_LIVES;
+            game.score = 0;
+        }
+
+        if (tick % CHECK_REPORT_INTERVAL == 0) {
+            printf("tick %6d sim %6u score %5d lives %d state %016llx\n", tick, game.sim_tick, game.score, game.lives,
+                   (unsigned long long)hash_state(&game));
+        }
+    }
+
+    collision_system_cleanup();
+    cleanup_all_entities(&game);
+    particle_system_destroy(&game.particles);
+    return 0;
+}